@@ -22,6 +22,7 @@ CHARTS_DIR="data/charts"
 # Flags to enable/disable ILP solvers
 RUN_CPLEX=false
 RUN_AMPL=false
+RUN_BNB=false # In-process branch and bound (-s bnb), optimal reference for small instances without CPLEX/AMPL
 
 VENV_PATH="data/venv"
 
@@ -90,7 +91,12 @@ for dat_file in "$DAT_DIR"/*.dat; do
   t_abs=$(realpath "$task_json")
   n_abs=$(realpath "$net_json")
 
-  for strategy in random annealing genetic; do
+  strategies=(random annealing genetic)
+  if [[ "${RUN_BNB:-false}" == true ]]; then
+    strategies+=(bnb)
+  fi
+
+  for strategy in "${strategies[@]}"; do
 
     echo "Using strategy: $strategy, for instance: $instance_name"
 
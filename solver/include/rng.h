@@ -0,0 +1,60 @@
+#ifndef RNG_H
+#define RNG_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace utils {
+
+// Random number generator of the solvers: xoshiro256++ (Blackman and Vigna), 256 bits of state.
+// An instance is not thread-safe; parallel code gets one stream per thread with split(), which
+// jumps 2^128 draws ahead for each stream, so streams never overlap and only depend on the seed.
+// Satisfies UniformRandomBitGenerator, so it can also feed the <random> distributions.
+class Rng {
+public:
+    using result_type = uint64_t;
+
+    explicit Rng(uint64_t seed = 0) { this->seed(seed); }
+
+    void seed(uint64_t seed); // State is expanded from seed with splitmix64
+    void jump(); // Advances 2^128 draws
+    std::vector<Rng> split(size_t count); // count independent streams (this one is advanced past them)
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return UINT64_MAX; }
+
+    inline result_type operator()() { return next(); }
+
+    inline uint64_t next() {
+        const uint64_t result = rotl(s[0] + s[3], 23) + s[0];
+        const uint64_t t = s[1] << 17;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = rotl(s[3], 45);
+        return result;
+    }
+
+    inline double uniform() { return static_cast<double>(next() >> 11) * 0x1.0p-53; } // [0, 1)
+    inline double uniform(double a, double b) { return a + (b - a) * uniform(); } // [a, b)
+    inline size_t below(size_t n) { return static_cast<size_t>((static_cast<unsigned __int128>(next()) * n) >> 64); } // [0, n), multiply-shift without modulo
+    double normal(double mean = 0.0, double stddev = 1.0); // Marsaglia polar method, keeps the second deviate
+
+    // Batched generation, for loops that need one number per task
+    void fillUniform(double* out, size_t count);
+    void fillNormal(double* out, size_t count, double mean = 0.0, double stddev = 1.0);
+
+private:
+    static inline uint64_t rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+    uint64_t s[4];
+    double spare = 0.0;
+    bool hasSpare = false;
+};
+
+} // namespace utils
+
+#endif // RNG_H
@@ -6,6 +6,7 @@
 #include <string>
 #include <iomanip>
 #include <algorithm>
+#include <limits>
 #include "utils.h"
 #include "json.hpp"
 #include "task.h"
@@ -54,6 +55,7 @@ public:
         DEADLINE_MISSED, // task misses deadline
         UTILIZATION_UNFEASIBLE, // server over-utilized
         MEMORY_UNFEASIBLE, // server out of memory
+        BOUND_EXCEEDED, // objective lower bound above the requested upper bound (evaluation stopped early)
     } schedule_state;
 
     ScheduleState(State state = NOT_SCHEDULED) : schedule_state(state) {}
@@ -69,18 +71,203 @@ public:
     }
 };
 
+struct CompiledInstance { // Flat read-only view of the instance, built once at load time for the scheduling hot path
+    int task_count = 0;
+    int server_count = 0;
+
+    // Tasks (structure of arrays indexed by dense task index)
+    std::vector<int> C;
+    std::vector<int> D;
+    std::vector<int> a;
+    std::vector<int> M;
+    std::vector<double> u;
+    std::vector<int> fixed_server; // Server index of the fixed allocation, -1 if the task is not fixed
+    std::vector<int> min_finish; // Earliest possible finish time (activation and precedences only, no delays or server contention)
+    long long min_finish_sum = 0;
+    std::vector<int> graph_order; // A topological order of the tasks that ignores priorities (incomplete if the graph has a cycle)
+
+    // Precedences in CSR format: predecessors of task i are pred_idxs[pred_offsets[i] .. pred_offsets[i+1])
+    std::vector<int> pred_offsets;
+    std::vector<int> pred_idxs;
+    std::vector<int> succ_offsets;
+    std::vector<int> succ_idxs;
+
+    // Servers
+    std::vector<char> server_is_mist;
+    std::vector<int> server_memory;
+    std::vector<int> server_cost;
+    std::vector<double> server_utilization;
+    std::vector<int> delay; // server_count x server_count, row major (INT_MAX if disconnected)
+    int min_server_cost = 0;
+
+    // Servers each task may be allocated to (see compileInstance()): servers of task i are
+    // allowed_servers[allowed_offsets[i] .. allowed_offsets[i+1]), and allowed_mask holds the same sets
+    // as allowed_words 64-bit words per task
+    std::vector<int> allowed_offsets;
+    std::vector<int> allowed_servers;
+    std::vector<unsigned long long> allowed_mask;
+    int allowed_words = 0;
+
+    // NOT_SCHEDULED for a valid graph, PRECEDENCES_ERROR or SUCCESSORS_ERROR if a task references an unknown task
+    ScheduleState graph_state = ScheduleState::NOT_SCHEDULED;
+
+    inline int getDelay(int from_server, int to_server) const { return delay[from_server * server_count + to_server]; }
+    inline int getAllowedCount(int task) const { return allowed_offsets[task + 1] - allowed_offsets[task]; }
+    inline int getAllowedServer(int task, int k) const { return allowed_servers[allowed_offsets[task] + k]; }
+    inline bool isAllowed(int task, int server) const { return (allowed_mask[(size_t)task * allowed_words + server / 64] >> (server % 64)) & 1ULL; }
+};
+
+struct EvalResult { // Outcome of a schedule evaluation, objective components are computed during the pass
+    EvalResult(ScheduleState state = ScheduleState::NOT_SCHEDULED) : state(state) {}
+    EvalResult(ScheduleState state, int failed_task) : state(state), failed_task(failed_task) {}
+
+    ScheduleState state;
+    int failed_task = -1; // Task whose placement made the schedule infeasible (-1 if scheduled, stopped by the bound or not task related)
+    int finish_time_sum = 0;
+    int processors_cost = 0;
+    int delay_cost = 0;
+    int schedule_span = 0;
+};
+
+struct ObjectiveBound { // Optional cut-off for evaluations
+    // Evaluation stops with BOUND_EXCEEDED as soon as a lower bound of
+    // alpha * finish_time_sum + beta * delay_cost + gamma * processors_cost exceeds value.
+    // The bound is ignored if value is infinite or any weight is negative.
+    double alpha = 1.0;
+    double beta = 0.0;
+    double gamma = 0.0;
+    double value = std::numeric_limits<double>::infinity();
+
+    ObjectiveBound() = default;
+    ObjectiveBound(double alpha, double beta, double gamma, double value) : alpha(alpha), beta(beta), gamma(gamma), value(value) {}
+
+    inline bool isSet() const { return value < std::numeric_limits<double>::infinity() && alpha >= 0.0 && beta >= 0.0 && gamma >= 0.0; }
+};
+
+enum ReadyQueueType { // Ready queue of the topological sort (both give the same order)
+    BINARY_HEAP,    // Binary heap of all ready tasks, O(log N) per operation
+    BUCKET_QUEUE    // Tasks quantised into N buckets by priority, O(1) per operation for spread out priorities and O(log N) when they pile up
+};
+
+struct PQItem { // Ready task in the priority queue of the topological sort
+    double pr;
+    int idx;
+};
+
+struct PQItemCmp {
+    bool operator()(const PQItem& a, const PQItem& b) const {
+        if (a.pr != b.pr) return a.pr < b.pr; // max-heap
+        return a.idx > b.idx; // deterministic tie-break by index (lower index first)
+    }
+};
+
+struct TopoOrderEntry { // Topological order computed for a priority vector
+    unsigned long long hash = 0;
+    std::vector<double> priorities;
+    std::vector<int> order;
+};
+
+struct StageRejections { // Candidates rejected by each stage of an evaluation
+    long long capacity = 0;   // Stage 1 (staged evaluation only): invalid or MIST servers, memory or utilization, O(N)
+    long long deadline = 0;   // Stage 2 (staged evaluation only): disconnected predecessors or deadline lower bounds, O(N+E)
+    long long simulation = 0; // Stage 3: infeasible in the timing simulation
+};
+
+struct ScheduleWorkspace { // Scratch buffers owned by the caller and reused across evaluations
+    // Buffers are sized on first use for a given instance; later evaluations do not allocate.
+    void prepare(const CompiledInstance& inst);
+    void clearTopoCache(); // Forget the cached topological orders (keeps their buffers)
+
+    std::vector<int> indeg;
+    std::vector<PQItem> heap;               // Backing storage of the ready queue (binary heap, also used by the bucket queue)
+    std::vector<int> bucket_head;           // Backing storage of the ready queue (bucket queue): first task of each bucket
+    std::vector<int> bucket_next;           // and next task of the same bucket (-1 at the end)
+    std::vector<int> topo_order;
+    std::vector<long long> server_ready;    // Time at which each server becomes free
+    std::vector<int> server_memory_left;
+    std::vector<double> server_utilization_left;
+    std::vector<int> server_task_count;
+
+    // Results of the last evaluation
+    std::vector<int> start_times;
+    std::vector<int> finish_times;
+    std::vector<int> server_of;             // Server hosting each task (-1 if not placed)
+    int placed_count = 0;                   // Number of tasks of topo_order placed on a server
+    int overflow_pos = -1;                  // Position of the placed task that exceeded a server capacity (-1 if none)
+
+    // State kept for Scheduler::evaluateIncremental(). A workspace must only be used with one instance.
+    bool cache_valid = false;               // The buffers below describe the last evaluated candidate
+    std::vector<int> last_server_indices;
+    std::vector<double> last_priorities;
+    std::vector<int> topo_pos;              // Position of each task in topo_order
+    std::vector<int> next_topo;             // Order under construction, swapped with topo_order
+    // Indexed by topo position: state of the hosting server before the task was placed,
+    // and objective components accumulated up to and including that position
+    std::vector<long long> prev_server_ready;
+    std::vector<int> prev_memory_left;
+    std::vector<double> prev_utilization_left;
+    std::vector<long long> prefix_finish_sum;
+    std::vector<long long> prefix_processors_cost;
+    std::vector<long long> prefix_delay_cost;
+    std::vector<int> prefix_span;
+    std::vector<long long> prefix_min_finish; // Sum of CompiledInstance::min_finish of the placed tasks
+
+    // Last topological orders, keyed by a hash of the priorities. The order only depends on the DAG and the
+    // priorities, so moves that only reassign servers, or that go back to a recent priority vector
+    // (e.g. after a rejected move), reuse it instead of running Kahn's algorithm again.
+    static constexpr int TOPO_CACHE_SIZE = 4;
+    TopoOrderEntry topo_cache[TOPO_CACHE_SIZE];
+    int topo_cache_next = 0;                // Entry replaced by the next insertion (round robin)
+
+    // Buffers of the screening stages of a staged evaluation, apart from the ones the incremental state lives in
+    std::vector<long long> screen_memory_left;
+    std::vector<double> screen_utilization_left;
+    std::vector<int> screen_task_count;
+    std::vector<int> screen_last_task;      // Last task counted on each server
+    std::vector<long long> screen_finish;   // Lower bound of the finish time of each task
+    bool screened = false;                  // The last evaluation was rejected by the screening, before any simulation
+    StageRejections rejections;             // Counters of the evaluations done with this workspace
+};
+
+struct ScheduleSnapshot { // Compact copy of a schedule, kept by solvers instead of a full Scheduler copy
+    ScheduleSnapshot(size_t task_count = 0) : candidate(task_count) {}
+
+    Candidate candidate;                    // Candidate the schedule was built from
+    std::vector<int> start_times;
+    std::vector<int> finish_times;
+    std::vector<int> task_server_idxs;
+    // Tasks of each server in execution order: tasks of server s are server_tasks[server_offsets[s] .. server_offsets[s+1])
+    std::vector<int> server_offsets;
+    std::vector<int> server_tasks;
+    EvalResult result;                      // State and objective components
+};
+
 class Scheduler {
     public:
         Scheduler() = default;
         Scheduler(std::string dat_file);    
         Scheduler(std::string tasks_file, std::string network_file);
         
-        ScheduleState schedule(const Candidate& candidate);
+        ScheduleState schedule(const Candidate& candidate, const ObjectiveBound& bound = ObjectiveBound()); // Evaluates and keeps the result as the current schedule
+
+        // Evaluation without side effects: times and servers are left in the caller's workspace.
+        // Thread-safe as long as each thread uses its own workspace.
+        EvalResult evaluate(const Candidate& candidate, ScheduleWorkspace& ws, const ObjectiveBound& bound = ObjectiveBound()) const;
+        EvalResult evaluateIncremental(const Candidate& candidate, ScheduleWorkspace& ws, const ObjectiveBound& bound = ObjectiveBound()) const; // Same result as evaluate(), reusing the previous evaluation held by ws
+        EvalResult evaluateUnstaged(const Candidate& candidate, ScheduleWorkspace& ws, const ObjectiveBound& bound = ObjectiveBound()) const; // evaluate() without the staged screening
+        // Evaluates independent candidates in parallel (OpenMP), results[i] corresponds to candidates[i]
+        void evaluateBatch(const std::vector<Candidate>& candidates, std::vector<EvalResult>& results, const ObjectiveBound& bound = ObjectiveBound());
+        void evaluateBatch(const std::vector<Candidate>& candidates, std::vector<EvalResult>& results, const std::vector<ObjectiveBound>& bounds); // bounds[i] applies to candidates[i]
 
         void importScheduleFromCSV(const std::string& csv_data);
         Candidate getCandidateFromCurrentSchedule() const;
+
+        // The snapshot reuses the storage of out, restoring it rebuilds the schedule and the servers' task lists
+        void saveSnapshot(const Candidate& candidate, ScheduleSnapshot& out) const;
+        void restoreSnapshot(const ScheduleSnapshot& snapshot);
         
         inline const ScheduleState getScheduleState() const { return state; }
+        inline const EvalResult& getEvalResult() const { return result; }
         inline const std::string getInstanceName() const { return instance_name; }
         inline const size_t getTaskCount() const { return tasks.size(); }
         inline const size_t getServerCount() const { return servers.size(); }
@@ -88,6 +275,16 @@ class Scheduler {
         inline const Task& getTask(size_t index) const { return tasks.at(index); }
         inline const Server& getServer(size_t index) const { return servers.at(index); }
         inline const int getNonMISTServerIdx(size_t index) const { return non_mist_servers_idxs.at(index); }
+        inline const size_t getAllowedServerCount(size_t task_index) const { return instance.getAllowedCount((int)task_index); } // Servers the task may be allocated to
+        inline const int getAllowedServerIdx(size_t task_index, size_t index) const { return instance.getAllowedServer((int)task_index, (int)index); }
+        inline const int getStartTime(size_t task_index) const { return start_times.at(task_index); }
+        inline const int getFinishTime(size_t task_index) const { return finish_times.at(task_index); }
+        inline const int getTaskServerIdx(size_t task_index) const { return task_server_idxs.at(task_index); } // -1 if not allocated
+        inline const CompiledInstance& getCompiledInstance() const { return instance; }
+        inline ReadyQueueType getReadyQueue() const { return ready_queue; }
+        inline void setReadyQueue(ReadyQueueType type) { ready_queue = type; }
+        inline bool getStagedRejection() const { return staged_rejection; }
+        inline void setStagedRejection(bool enabled) { staged_rejection = enabled; }
 
         int getScheduleSpan() const;
         int getFinishTimeSum() const;
@@ -105,13 +302,31 @@ class Scheduler {
         std::vector<Connection> connections; // Connections are duplicated for bidirectional links
         std::vector<std::vector<int>> delay_matrix;
         std::string instance_name;
+        CompiledInstance instance; // Must be rebuilt with compileInstance() whenever tasks or servers change
+        ScheduleWorkspace workspace; // Scratch buffers used by schedule()
+        ReadyQueueType ready_queue = ReadyQueueType::BINARY_HEAP; // Ready queue used by the topological sort of every evaluation
+        // Staged evaluation: candidates go through O(N) capacity checks and O(N+E) deadline bounds before the
+        // timing simulation of a full evaluation (incremental re-evaluations skip them, see evaluateIncremental()).
+        bool staged_rejection = false;
+        std::vector<ScheduleWorkspace> batch_workspaces; // One per worker thread, used by evaluateBatch()
+
+        // Current schedule (indexed by task). Servers only keep the indices of their tasks.
+        std::vector<int> start_times;
+        std::vector<int> finish_times;
+        std::vector<int> task_server_idxs;
 
         ScheduleState state;
+        EvalResult result; // Objective components of the current schedule
 
         void loadScheduleFromDatFile(const std::string& file_path);
         void loadTasksFromJSONFile(const std::string& file_path);
         void loadNetworkFromJSONFile(const std::string& file_path);
         void computeDelayMatrix();
+        void compileInstance();
+        void resetScheduleTimes();
+        EvalResult summarizeSchedule() const;
+        // Shared body of the evaluateBatch() overloads: candidate c uses bounds[c * bound_stride]
+        void evaluateBatch(const std::vector<Candidate>& candidates, std::vector<EvalResult>& results, const ObjectiveBound* bounds, size_t bound_stride);
 
         std::string printTxt() const;
         std::string printJSON() const;
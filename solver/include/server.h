@@ -1,9 +1,8 @@
 #ifndef SERVER_H
 #define SERVER_H
 
-#include <deque>
+#include <vector>
 #include "json.hpp"
-#include "task.h"
 #include "utils.h"
 
 
@@ -36,14 +35,12 @@ public:
     inline double getUtilization() const { return utilization; }
     inline int getLastSlot() const { return last_slot; }
     
-    inline const std::deque<Task>& getAssignedTasks() const { return assigned_tasks; }
-    inline std::deque<Task>& getAssignedTasks() { return assigned_tasks; }
+    inline const std::vector<int>& getAssignedTasks() const { return assigned_tasks; } // Task indices in execution order
 
     inline void setId(const std::string& id_) { id = id_; }
     inline void setInternalIdx(int internal_idx_) { internal_idx = internal_idx_; }
 
-    void pushBackTask(const Task& task);
-    void pushFrontTask(const Task& task);
+    void pushBackTask(int task_idx, int task_memory, double task_utilization, int finish_time);
     void clearTasks();
 
     inline double getAvailableUtilization() const { return available_utilization; }
@@ -60,7 +57,7 @@ private:
     double utilization; // 0..1, total utilization.
     double available_utilization; // available utilization for allocating tasks. Initially equals total utilization
     int last_slot; // Last slot occupied by a task
-    std::deque<Task> assigned_tasks;
+    std::vector<int> assigned_tasks; // Indices of the tasks allocated to this server
 };
 
 #endif // SERVER_H
\ No newline at end of file
@@ -3,7 +3,11 @@
 
 #include <yaml-cpp/yaml.h>
 #include <fstream>
+#include <memory>
+#include <atomic>
+#include <mutex>
 #include "utils.h"
+#include "rng.h"
 #include "scheduler.h"
 
 enum PriorityRefinementMethod {
@@ -14,12 +18,27 @@ enum PriorityRefinementMethod {
 enum SolverMethod {
     RANDOM_SEARCH,
     GENETIC_ALGORITHM,
-    SIMULATED_ANNEALING
+    SIMULATED_ANNEALING,
+    PARALLEL_TEMPERING,
+    HEFT,
+    TABU_SEARCH,
+    LARGE_NEIGHBORHOOD_SEARCH,
+    BRANCH_AND_BOUND
 };
 
 std::string solverMethodToString(SolverMethod method);
 std::string priorityRefinementMethodToString(PriorityRefinementMethod method);
 
+struct GAIslandConfig { // Per-island overrides of the ga_* parameters (negative values inherit the global one)
+    long long populationSize = -1;
+    int maxGenerations = -1;
+    long long eliteCount = -1;
+    double stagnationThreshold = -1.0;
+    int stagnationLimit = -1;
+    double mutationRate = -1.0;
+    double crossoverRate = -1.0;
+};
+
 class SolverConfig { // Configuration parameters for the solver
 public:
     SolverConfig() : log(&utils::dbg) {}
@@ -31,6 +50,13 @@ public:
     double beta = 0.0;  // Weight for delay cost in objective function
     double gamma = 0.0; // Weight for processors cost in objective function
 
+    int threads = 0; // Worker threads for the parallel parts of the solvers (0 uses the OpenMP default)
+    unsigned long long seed = 0; // Random seed (0 draws one from the clock); runs are reproducible for a fixed seed and thread count, except the methods whose threads exchange solutions (GA islands, multi-start SA, B&B)
+    bool heftInit = true; // SA, PT and GA start from the HEFT solution when it is feasible
+    int repairSteps = 3; // Moves of the repair operator on an infeasible neighbor or child (0 = discard infeasible candidates)
+    ReadyQueueType readyQueue = ReadyQueueType::BINARY_HEAP; // Ready queue of the topological sort in every evaluation
+    bool stagedRejection = false; // Capacity and deadline bound checks before the timing simulation in every evaluation
+
     // Parameters for Simulated Annealing
     int sa_maxInitTries = 3000;
     int sa_maxIterations = 3000;
@@ -42,6 +68,9 @@ public:
     double sa_initialTemperature = 100.0;
     double sa_coolingRate = 0.995;
     double sa_minTemperature = 1e-3;
+    // Multi-start (used when sa_chains != 1): independent chains, one per thread, sharing the best solution
+    int sa_chains = 1; // Number of chains (0 = one per thread)
+    double sa_restartGap = 0.2; // A chain restarts from the shared best when its fitness exceeds it by this fraction (negative = never)
     // Refinement parameters
     PriorityRefinementMethod sa_priorityRefinementMethod = PriorityRefinementMethod::NORMAL_PERTURBATION;
     double sa_sigmaMax = 0.1; // Maximum standard deviation for priority refinement (use smaller values for finer adjustments)
@@ -53,6 +82,39 @@ public:
     double sa_pso_cognitiveCoefficient = 1.5;
     double sa_pso_socialCoefficient = 1.5;
 
+    // Parameters for Parallel Tempering (initial solution uses sa_maxInitTries)
+    int pt_replicas = 0; // Number of replicas (0 = one per thread, at least 2)
+    int pt_maxIterations = 3000; // Metropolis steps per replica
+    int pt_timeout_sec = 600;
+    int pt_exchangeInterval = 10; // Steps between replica exchanges
+    double pt_minTemperature = 1.0; // Temperature of the coldest replica
+    double pt_maxTemperature = 100.0; // Temperature of the hottest replica
+    double pt_perturbationRate = 0.1;
+    int pt_stagnationLimit = 100; // Exchange rounds without improvement before stopping
+
+    // Parameters for Tabu Search (initial solution uses sa_maxInitTries)
+    int ts_maxIterations = 1000;
+    int ts_timeout_sec = 600;
+    int ts_tenure = 10; // Iterations a move stays tabu
+    int ts_neighborhoodSize = 200; // Random moves evaluated per iteration (0 = whole neighborhood)
+    int ts_stagnationLimit = 100; // Iterations without improving the best solution before stopping
+
+    // Parameters for Adaptive Large Neighborhood Search (initial solution uses sa_maxInitTries)
+    int lns_maxIterations = 1000;
+    int lns_timeout_sec = 600;
+    int lns_stagnationLimit = 200;
+    double lns_destroyFraction = 0.1; // Fraction of the tasks removed by a destroy operator
+    int lns_maxDestroy = 30; // Upper limit of the tasks removed at once
+    int lns_exhaustiveLimit = 256; // Allocations enumerated by the exhaustive repair operator
+    int lns_segmentLength = 50; // Iterations between updates of the operator weights
+    double lns_reactionFactor = 0.2; // How fast the operator weights follow their recent scores
+    double lns_acceptanceGap = 0.02; // Worse solutions are accepted within this fraction of the best one
+
+    // Parameters for Branch and Bound (exact, for small instances)
+    int bb_timeout_sec = 60; // Optimality is not proven if the search stops by timeout
+    long long bb_maxNodes = 0; // Node limit (0 = no limit)
+    bool bb_warmStart = true; // Improve the initial incumbent (HEFT) with a large neighborhood search run
+
     // Parameters for Random Search
     int rs_maxIterations = 1000;
     int rs_timeout_sec = 600;
@@ -72,6 +134,11 @@ public:
     int ga_stagnationLimit = 50;
     double ga_mutationRate = 0.15;
     double ga_crossoverRate = 0.75;
+    // Island model (used when ga_islands > 1): one population per island and thread
+    int ga_islands = 1;
+    int ga_migrationInterval = 20; // Generations between migrations
+    size_t ga_migrationSize = 2; // Best individuals sent to the next island of the ring
+    std::vector<GAIslandConfig> ga_islandsConfig; // Entry k overrides the ga_* parameters of island k
 
     // Randomization parameters
     int allocationNoiseLevel = 10; // Noise level for task allocation randomization (higher values increase randomness)
@@ -86,7 +153,9 @@ public:
     std::string print() const;
 
 private:
-    std::ofstream log_file_stream;
+    void setIslandParameter(size_t island, const std::string& key, const std::string& val);
+
+    std::shared_ptr<std::ofstream> log_file_stream; // Shared, so copies of a config (one per thread) log to the same file
 };
 
 
@@ -123,6 +192,17 @@ public:
     long memoryUsageKB;
     std::string observations;
 
+    struct ChainStats { // Statistics of one chain of a multi-start run
+        int iterations;
+        int bestFitness;
+        int restarts; // Times the chain fell behind and restarted from the shared incumbent
+        int incumbentUpdates; // Times the chain improved the shared incumbent
+    };
+    std::vector<ChainStats> chains; // Empty for single chain runs
+
+    int infeasibleCandidates = 0; // Neighbors or children found infeasible (SA, PT and GA)
+    int repairedCandidates = 0; // Infeasible candidates made feasible by the repair operator
+
     double getObjectiveValue() const;
 
     static std::string getHeaderCSV();
@@ -191,6 +271,24 @@ private:
     std::string printTxt() const;
 };
 
+// Best solution shared by concurrent solver chains. The fitness is published with an atomic
+// compare-and-swap so chains can poll it without locking; the candidate is copied in and out under
+// a mutex, which is only taken on improvements and restarts.
+class SharedIncumbent {
+public:
+    explicit SharedIncumbent(size_t taskCount) : candidate(taskCount) {}
+
+    inline int getFitness() const { return fitness.load(std::memory_order_acquire); }
+    bool offer(const Candidate& offered, int offeredFitness); // Returns true if offered became the incumbent
+    int load(Candidate& out) const; // Copies the incumbent to out and returns its fitness
+
+private:
+    std::atomic<int> fitness{INT_MAX};
+    mutable std::mutex candidateMutex;
+    int candidateFitness = INT_MAX; // Fitness of the candidate currently stored (can lag behind fitness)
+    Candidate candidate;
+};
+
 class Solver {
 public:
     Solver(Scheduler& sch, SolverConfig& config) : 
@@ -209,16 +307,50 @@ private:
     SolverConfig& config;
 
     double computeObjective() const;
+    double computeObjective(const EvalResult& result) const;
+    ObjectiveBound getObjectiveBound(double threshold) const; // Bound for candidates that are only useful if their fitness is below threshold
 
     SolverResult randomSearchSolve();
     SolverResult geneticAlgorithmSolve();
     SolverResult simulatedAnnealingSolve();
+    SolverResult islandGeneticAlgorithmSolve();
+    SolverResult parallelTemperingSolve();
+    SolverResult multiStartAnnealingSolve();
+    SolverResult heftSolve();
+    SolverResult tabuSearchSolve();
+    SolverResult largeNeighborhoodSearchSolve();
+    SolverResult branchAndBoundSolve();
+
+    Candidate buildHeftCandidate() const; // Deterministic list scheduling (upward rank + earliest finish time)
+    bool findInitialSolution(Candidate& initial, int maxInitTries); // Leaves the scheduler with initial if it returns true
+
+    SharedIncumbent* incumbent = nullptr; // Set for the chains of a multi-start run
+    utils::Rng rng; // Stream of the solver thread, seeded by solve(); parallel parts take streams split from it
+
+    // Repair of infeasible candidates (see repairCandidate())
+    struct RepairStats {
+        int infeasible = 0;
+        int repaired = 0;
+    };
+    EvalResult repairCandidate(Candidate& candidate, EvalResult result, ScheduleWorkspace& ws, RepairStats& stats, const ObjectiveBound& bound = ObjectiveBound()) const;
+
+    // Genetic algorithm building blocks (shared by the single population and the island model)
+    struct Individual {
+        Candidate candidate;
+        int fitness;
+        Individual() : candidate(0), fitness(INT_MAX) {}
+        Individual(const Candidate& candidate, int fit) : candidate(candidate), fitness(fit) {}
+    };
+    static bool fitterThan(const Individual& a, const Individual& b);
+    bool initializePopulation(std::vector<Individual>& population, size_t count, SolverResult& results, const std::chrono::high_resolution_clock::time_point& startTime);
+    Individual breedChild(const std::vector<Individual>& population, double crossoverRate, double mutationRate, utils::Rng& rng, ScheduleWorkspace& ws, RepairStats& repairStats) const;
 
     void refinePrioritiesNormal(Candidate& curr, int currFitness, double T);
     void refinePrioritiesPSO(Candidate& curr, int currFitness, double T);
     void refinePriorities(PriorityRefinementMethod refinementMethod, Candidate& curr, int currFitness, double T);
 
-    void randomizeCandidate(Candidate& candidate, double perturbationRate);
+    void randomizeCandidate(Candidate& candidate, double perturbationRate); // Draws from the solver stream
+    void randomizeCandidate(Candidate& candidate, double perturbationRate, utils::Rng& rng) const; // Thread-safe version using the caller's stream
 };
 
 
@@ -47,15 +47,12 @@ class Task {
         inline int getM() const { return M; }
         inline int getA() const { return a; }
         inline double getU() const { return u; }
-        inline int getStartTime() const { return start_time; }
-        inline int getFinishTime() const { return finish_time; }
         inline const std::vector<std::string>& getPredecessors() const { return predecessors; }
         inline const std::vector<int>& getPredecessorInternalIdxs() const { return predecessor_internal_idxs; }
         inline const std::vector<std::string>& getSuccessors() const { return successors; }
         inline const std::vector<int>& getSuccessorInternalIdxs() const { return successor_internal_idxs; }
 
         // Setters
-        inline void setStartTime(int start) { start_time = start; finish_time = start_time + C; }
         inline void addPredecessor(const std::string& pred_id, const int predecessor_internal_id = 0) { 
             predecessors.push_back(pred_id); 
             predecessor_internal_idxs.push_back(predecessor_internal_id); 
@@ -90,8 +87,6 @@ class Task {
         int T; // Period
         int D; // Deadline
         int a; // Activation time
-        int start_time; // Start time
-        int finish_time; // Finish time
 
         // Resource requirements
         int M; // Memory
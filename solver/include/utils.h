@@ -60,10 +60,6 @@ long getPeakMemoryUsageKB();
 
 long long getElapsedMs(const std::chrono::high_resolution_clock::time_point& start_time);
 
-// Random number generator
-static std::random_device rd;
-static std::mt19937 gen(rd());
-
 struct NullBuffer : std::streambuf {
     int overflow(int c) override { return c; }
 };
@@ -74,6 +70,21 @@ inline NullBuffer null_buffer;
 inline std::ostream null_stream(&null_buffer);
 inline std::ostream& dbg = null_stream;
 
+// Debug output of code that can also run in worker threads. dbg is a single shared stream, so a worker
+// installs a DbgCapture and its messages are kept in it until the owner logs them after joining.
+inline thread_local std::ostream* dbg_capture = nullptr;
+inline std::ostream& threadDbg() { return dbg_capture ? *dbg_capture : dbg; }
+
+struct DbgCapture { // Redirects threadDbg() of the current thread to a buffer while in scope
+    std::ostringstream buffer;
+    DbgCapture() : previous(dbg_capture) { dbg_capture = &buffer; }
+    ~DbgCapture() { dbg_capture = previous; }
+    DbgCapture(const DbgCapture&) = delete;
+    DbgCapture& operator=(const DbgCapture&) = delete;
+private:
+    std::ostream* previous;
+};
+
 // ANSI color codes for terminal output
 constexpr const char* red   = "\033[31m";
 constexpr const char* green = "\033[32m";
@@ -90,7 +101,6 @@ T require_type(const nlohmann::json&, const std::string&);
 
 inline bool areEqual(double a, double b) { return std::fabs(a - b) < 1e-9; }
 
-double randNormal(double mean, double stddev);
 double clamp(double value, double minVal, double maxVal);
 
 } // namespace utils
@@ -0,0 +1,217 @@
+#define MANUAL "assets/benchmark_manual.txt"
+
+#include <iostream>
+#include <cstring>
+#include <cstdlib>
+#include <atomic>
+#include <new>
+#include <vector>
+#include <chrono>
+#include <functional>
+#include <algorithm>
+#include <getopt.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "../include/utils.h"
+#include "../include/scheduler.h"
+
+// Allocation counter: every heap allocation of the process goes through these operators
+static std::atomic<long long> allocation_count{0};
+
+void* operator new(std::size_t size) {
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size ? size : 1)) return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+
+static struct option long_options[] = {
+    {"help",        no_argument,        0,  'h' },
+    {"tasks",       required_argument,  0,  't' },
+    {"network",     required_argument,  0,  'n' },
+    {"dat",         required_argument,  0,  'd' },
+    {"iterations",  required_argument,  0,  'k' },
+    {"dbg",         no_argument,        0,  'D' },
+    {0,             0,                  0,  0   }
+};
+
+struct BenchmarkRow {
+    std::string name;
+    int evaluations;
+    long long elapsed_ns;
+    long long allocations;
+    int feasible;
+};
+
+static BenchmarkRow runBenchmark(const std::string& name, int calls, const std::function<int(int)>& evaluate, int evaluationsPerCall = 1) {
+    // Runs one warm-up call (buffers are sized there) and then measures time and allocations.
+    // Each call returns the number of feasible candidates it evaluated.
+    evaluate(0);
+    int feasible = 0;
+    long long allocations_before = allocation_count.load();
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < calls; ++i) {
+        feasible += evaluate(i);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    long long allocations = allocation_count.load() - allocations_before;
+    long long elapsed_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    return BenchmarkRow{name, calls * evaluationsPerCall, elapsed_ns, allocations, feasible};
+}
+
+int main(int argc, char **argv) {
+
+    std::string tsk_filename;
+    std::string nw_filename;
+    std::string dat_filename;
+    int iterations = 10000;
+
+    int opt;
+    int option_index = 0;
+
+    while((opt = getopt_long(argc, argv, "ht:n:d:k:D", long_options, &option_index)) != -1) {
+        switch(opt) {
+            case 'h':
+                utils::printHelp(MANUAL);
+                return 0;
+            case 't':
+                tsk_filename = optarg;
+                break;
+            case 'n':
+                nw_filename = optarg;
+                break;
+            case 'd':
+                dat_filename = optarg;
+                break;
+            case 'k':
+                iterations = std::atoi(optarg);
+                break;
+            case 'D':
+                utils::dbg.rdbuf(std::cout.rdbuf());
+                break;
+            case '?':
+                return 1;
+        }
+    }
+
+    if(dat_filename.empty() && (tsk_filename.empty() || nw_filename.empty())) {
+        utils::printHelp(MANUAL, "Error: Must provide either DAT file or both tasks and network files.");
+    }
+
+    try {
+        Scheduler sch = dat_filename.empty() ? Scheduler(tsk_filename, nw_filename) : Scheduler(dat_filename);
+
+        const size_t taskCount = sch.getTaskCount();
+        if (taskCount == 0 || sch.getNonMISTServerCount() == 0) {
+            utils::throw_runtime_error("Instance has no tasks or no allocable servers.");
+        }
+
+        // Pool of random candidates (fixed seed, so runs are comparable)
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<double> uniform(0.0, 1.0);
+        std::vector<Candidate> pool;
+        const int poolSize = 64;
+        for (int c = 0; c < poolSize; ++c) {
+            Candidate candidate(taskCount);
+            for (size_t i = 0; i < taskCount; ++i) {
+                candidate.server_indices[i] = sch.getNonMISTServerIdx(rng() % sch.getNonMISTServerCount());
+                candidate.priorities[i] = uniform(rng);
+            }
+            pool.push_back(candidate);
+        }
+
+        // Neighbours of the first candidate differing in a single task, as produced by local search moves
+        std::vector<Candidate> neighbours;
+        for (int c = 0; c < poolSize; ++c) {
+            Candidate candidate = pool[0];
+            const size_t task = rng() % taskCount;
+            if (c % 2 == 0) {
+                candidate.server_indices[task] = sch.getNonMISTServerIdx(rng() % sch.getNonMISTServerCount());
+            } else {
+                candidate.priorities[task] = uniform(rng);
+            }
+            neighbours.push_back(candidate);
+        }
+
+        std::vector<BenchmarkRow> rows;
+
+        ScheduleWorkspace ws;
+        rows.push_back(runBenchmark("evaluate (workspace)", iterations, [&](int i) {
+            return sch.evaluate(pool[i % poolSize], ws).state == ScheduleState::SCHEDULED;
+        }));
+
+        // Same evaluations with the bucket ready queue in the topological sort (the pool cycles through more
+        // priority vectors than the workspace caches, so every call sorts)
+        sch.setReadyQueue(ReadyQueueType::BUCKET_QUEUE);
+        rows.push_back(runBenchmark("evaluate (bucket queue)", iterations, [&](int i) {
+            return sch.evaluate(pool[i % poolSize], ws).state == ScheduleState::SCHEDULED;
+        }));
+        sch.setReadyQueue(ReadyQueueType::BINARY_HEAP);
+
+        // Same evaluations with the capacity and deadline screening stages before the simulation
+        ScheduleWorkspace stagedWs;
+        sch.setStagedRejection(true);
+        rows.push_back(runBenchmark("evaluate (staged)", iterations, [&](int i) {
+            return sch.evaluate(pool[i % poolSize], stagedWs).state == ScheduleState::SCHEDULED;
+        }));
+        sch.setStagedRejection(false);
+
+        // Full evaluations of the neighbours. The ones that only move a task keep the priorities of the common
+        // candidate, whose order the workspace caches, so the first row forgets the cached orders before every call
+        rows.push_back(runBenchmark("evaluate (neighbours)", iterations, [&](int i) {
+            ws.clearTopoCache();
+            return sch.evaluate(neighbours[i % poolSize], ws).state == ScheduleState::SCHEDULED;
+        }));
+
+        rows.push_back(runBenchmark("evaluate (neighbours, cache)", iterations, [&](int i) {
+            return sch.evaluate(neighbours[i % poolSize], ws).state == ScheduleState::SCHEDULED;
+        }));
+
+        rows.push_back(runBenchmark("incremental (neighbours)", iterations, [&](int i) {
+            return sch.evaluateIncremental(neighbours[i % poolSize], ws).state == ScheduleState::SCHEDULED;
+        }));
+
+        std::vector<EvalResult> batchResults;
+        rows.push_back(runBenchmark("evaluateBatch", std::max(1, iterations / poolSize), [&](int) {
+            sch.evaluateBatch(pool, batchResults);
+            return (int)std::count_if(batchResults.begin(), batchResults.end(), [](const EvalResult& r) {
+                return r.state == ScheduleState::SCHEDULED;
+            });
+        }, poolSize));
+
+        rows.push_back(runBenchmark("schedule", iterations, [&](int i) {
+            return sch.schedule(pool[i % poolSize]) == ScheduleState::SCHEDULED;
+        }));
+
+        std::cout << "Instance: " << sch.getInstanceName() << " (" << taskCount << " tasks, " << sch.getServerCount() << " servers)\n";
+#ifdef _OPENMP
+        std::cout << "Threads: " << omp_get_max_threads() << "\n";
+#endif
+        std::cout << std::left << std::setw(32) << "Method"
+                  << std::right << std::setw(12) << "Evals"
+                  << std::setw(14) << "ns/eval"
+                  << std::setw(14) << "allocs/eval"
+                  << std::setw(12) << "Feasible" << "\n";
+        for (const auto& row : rows) {
+            std::cout << std::left << std::setw(32) << row.name
+                      << std::right << std::setw(12) << row.evaluations
+                      << std::setw(14) << (row.evaluations ? row.elapsed_ns / row.evaluations : 0)
+                      << std::setw(14) << std::fixed << std::setprecision(2) << (row.evaluations ? (double)row.allocations / row.evaluations : 0.0)
+                      << std::setw(12) << row.feasible << "\n";
+        }
+        std::cout << "Staged rejections: " << stagedWs.rejections.capacity << " capacity, "
+                  << stagedWs.rejections.deadline << " deadline, "
+                  << stagedWs.rejections.simulation << " simulation\n";
+
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,90 @@
+#include "../include/rng.h"
+#include <cmath>
+
+namespace utils {
+
+void Rng::seed(uint64_t seed) {
+    // splitmix64, so that close seeds give unrelated states (and the state is never all zeros)
+    for (auto& word : s) {
+        uint64_t z = (seed += 0x9e3779b97f4a7c15ULL);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        word = z ^ (z >> 31);
+    }
+    hasSpare = false;
+}
+
+void Rng::jump() {
+    static const uint64_t JUMP[] = { 0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL, 0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL };
+
+    uint64_t t[4] = { 0, 0, 0, 0 };
+    for (const uint64_t word : JUMP) {
+        for (int b = 0; b < 64; ++b) {
+            if (word & (UINT64_C(1) << b)) {
+                for (int i = 0; i < 4; ++i) {
+                    t[i] ^= s[i];
+                }
+            }
+            next();
+        }
+    }
+    for (int i = 0; i < 4; ++i) {
+        s[i] = t[i];
+    }
+    hasSpare = false;
+}
+
+std::vector<Rng> Rng::split(size_t count) {
+    std::vector<Rng> streams;
+    streams.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        jump();
+        streams.push_back(*this);
+    }
+    jump(); // This stream continues past all of them
+    return streams;
+}
+
+double Rng::normal(double mean, double stddev) {
+    if (hasSpare) {
+        hasSpare = false;
+        return mean + stddev * spare;
+    }
+    double u, v, q;
+    do {
+        u = 2.0 * uniform() - 1.0;
+        v = 2.0 * uniform() - 1.0;
+        q = u * u + v * v;
+    } while (q >= 1.0 || q == 0.0);
+    const double factor = std::sqrt(-2.0 * std::log(q) / q);
+    spare = v * factor;
+    hasSpare = true;
+    return mean + stddev * u * factor;
+}
+
+void Rng::fillUniform(double* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = uniform();
+    }
+}
+
+void Rng::fillNormal(double* out, size_t count, double mean, double stddev) {
+    // Deviates come in pairs from the polar method, no spare is carried between calls
+    size_t i = 0;
+    while (i + 1 < count) {
+        double u, v, q;
+        do {
+            u = 2.0 * uniform() - 1.0;
+            v = 2.0 * uniform() - 1.0;
+            q = u * u + v * v;
+        } while (q >= 1.0 || q == 0.0);
+        const double factor = stddev * std::sqrt(-2.0 * std::log(q) / q);
+        out[i++] = mean + u * factor;
+        out[i++] = mean + v * factor;
+    }
+    if (i < count) {
+        out[i] = normal(mean, stddev);
+    }
+}
+
+} // namespace utils
@@ -0,0 +1,672 @@
+#include "scheduler.h"
+#include <cstring>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+void ScheduleWorkspace::prepare(const CompiledInstance& inst) {
+    // Resizing to the same size keeps the capacity, so this only allocates on the first call
+    const int N = inst.task_count;
+    const int S = inst.server_count;
+    indeg.resize(N);
+    heap.reserve(N);
+    if ((int)bucket_head.size() != std::max(N, 1)) {
+        bucket_head.assign(std::max(N, 1), -1);
+    }
+    bucket_next.resize(N);
+    topo_order.reserve(N);
+    server_ready.resize(S);
+    server_memory_left.resize(S);
+    server_utilization_left.resize(S);
+    server_task_count.resize(S);
+    start_times.resize(N);
+    finish_times.resize(N);
+    server_of.resize(N);
+    last_server_indices.reserve(N);
+    last_priorities.reserve(N);
+    topo_pos.resize(N);
+    next_topo.reserve(N);
+    prev_server_ready.resize(N);
+    prev_memory_left.resize(N);
+    prev_utilization_left.resize(N);
+    prefix_finish_sum.resize(N);
+    prefix_processors_cost.resize(N);
+    prefix_delay_cost.resize(N);
+    prefix_span.resize(N);
+    prefix_min_finish.resize(N);
+    screen_memory_left.resize(S);
+    screen_utilization_left.resize(S);
+    screen_task_count.resize(S);
+    screen_last_task.resize(S);
+    screen_finish.resize(N);
+};
+
+void ScheduleWorkspace::clearTopoCache() {
+    // An entry only matches priority vectors of the size of its order
+    for (TopoOrderEntry& entry : topo_cache) {
+        entry.order.clear();
+    }
+};
+
+namespace {
+
+// Ready queue backed by a binary heap (max-heap by priority, lower index first on ties)
+struct HeapQueue {
+    std::vector<PQItem>& heap;
+    PQItemCmp cmp;
+
+    explicit HeapQueue(ScheduleWorkspace& ws) : heap(ws.heap) { heap.clear(); }
+
+    inline bool empty() const { return heap.empty(); }
+
+    inline void push(const PQItem& item) {
+        heap.push_back(item);
+        std::push_heap(heap.begin(), heap.end(), cmp);
+    }
+
+    inline int pop() {
+        std::pop_heap(heap.begin(), heap.end(), cmp);
+        const int idx = heap.back().idx;
+        heap.pop_back();
+        return idx;
+    }
+};
+
+// Ready queue with one bucket per task over the range of the priorities (usually [0,1]).
+// Each bucket is an unordered linked list through ws.bucket_next, and buckets follow the priority order.
+// A bucket with a single task is popped directly; a larger one is moved to a binary heap (ws.heap, same
+// order as HeapQueue), and tasks pushed to that bucket or above go to the heap until it is drained, so
+// tasks come out in exactly the same order as with HeapQueue. With spread out priorities push and pop are
+// O(1) apart from the scan over empty buckets (O(N) per sort in total); when priorities pile up in a few
+// buckets (e.g. clamped to 0 or 1) the operations degrade to O(log N), as with the heap.
+// Kahn's algorithm drains the queue, so every bucket is empty (-1) between calls.
+struct BucketQueue {
+    std::vector<int>& head;
+    std::vector<int>& next;
+    std::vector<PQItem>& heap;
+    PQItemCmp cmp;
+    const std::vector<double>& priorities;
+    double low = 0.0;
+    double scale = 0.0;       // Buckets per unit of priority
+    int top = 0;              // No bucket list above this one holds a task
+    int heapFloor = INT_MAX;  // Tasks of this bucket and above go to the heap while it is not empty
+    int count = 0;
+
+    BucketQueue(ScheduleWorkspace& ws, const std::vector<double>& priorities) : head(ws.bucket_head), next(ws.bucket_next), heap(ws.heap), priorities(priorities) {
+        heap.clear();
+        if (priorities.empty()) return;
+        const auto range = std::minmax_element(priorities.begin(), priorities.end());
+        low = *range.first;
+        if (*range.second > low) {
+            scale = (double)head.size() / (*range.second - low);
+        }
+    }
+
+    inline int bucketOf(double pr) const {
+        const double b = (pr - low) * scale;
+        if (!(b > 0.0)) return 0;
+        return std::min((int)head.size() - 1, (int)b);
+    }
+
+    inline bool empty() const { return count == 0; }
+
+    inline void push(const PQItem& item) {
+        const int b = bucketOf(item.pr);
+        count++;
+        if (b >= heapFloor) {
+            heap.push_back(item);
+            std::push_heap(heap.begin(), heap.end(), cmp);
+            return;
+        }
+        next[item.idx] = head[b];
+        head[b] = item.idx;
+        top = std::max(top, b);
+    }
+
+    inline int pop() {
+        count--;
+        if (heap.empty()) {
+            heapFloor = INT_MAX;
+            while (head[top] < 0) {
+                --top;
+            }
+            const int idx = head[top];
+            head[top] = next[idx];
+            if (head[top] < 0) {
+                return idx; // Only task of the highest bucket
+            }
+            // Several tasks share the highest bucket: order them in the heap
+            heap.push_back(PQItem{ priorities[idx], idx });
+            for (int t = head[top]; t >= 0; t = next[t]) {
+                heap.push_back(PQItem{ priorities[t], t });
+            }
+            std::make_heap(heap.begin(), heap.end(), cmp);
+            head[top] = -1;
+            heapFloor = top;
+        }
+        std::pop_heap(heap.begin(), heap.end(), cmp);
+        const int idx = heap.back().idx;
+        heap.pop_back();
+        return idx;
+    }
+};
+
+// Kahn's algorithm with priority tie-breaker, continued after the first `first` entries of `order`,
+// which must already be a topological prefix (ws.topo_pos is used to skip its tasks).
+// Ready tasks are popped from the queue by priority value (higher priority popped first).
+// Returns false if not all tasks could be ordered (cycle).
+template <typename ReadyQueue>
+bool kahnTopoOrder(const CompiledInstance& inst, const std::vector<double>& priorities, ScheduleWorkspace& ws, std::vector<int>& order, int first, ReadyQueue& queue) {
+    const int N = inst.task_count;
+
+    // Indegree (number of predecessors not yet ordered) for each task
+    for (int i = 0; i < N; ++i) {
+        ws.indeg[i] = inst.pred_offsets[i + 1] - inst.pred_offsets[i];
+    }
+    order.resize(first);
+    for (int u : order) {
+        for (int k = inst.succ_offsets[u]; k < inst.succ_offsets[u + 1]; ++k) {
+            --ws.indeg[inst.succ_idxs[k]];
+        }
+    }
+
+    for (int i = 0; i < N; ++i) {
+        if (ws.indeg[i] == 0 && (first == 0 || ws.topo_pos[i] >= first)) {
+            queue.push(PQItem{ priorities[i], i });
+        }
+    }
+
+    while (!queue.empty()) {
+        const int u = queue.pop();
+        order.push_back(u);
+
+        for (int k = inst.succ_offsets[u]; k < inst.succ_offsets[u + 1]; ++k) {
+            const int v = inst.succ_idxs[k];
+            if (--ws.indeg[v] == 0) {
+                queue.push(PQItem{ priorities[v], v });
+            }
+        }
+    }
+
+    return (int)order.size() == N;
+}
+
+bool completeTopoOrder(const CompiledInstance& inst, const std::vector<double>& priorities, ScheduleWorkspace& ws, std::vector<int>& order, int first, ReadyQueueType type) {
+    if (type == ReadyQueueType::BUCKET_QUEUE) {
+        BucketQueue queue(ws, priorities);
+        return kahnTopoOrder(inst, priorities, ws, order, first, queue);
+    }
+    HeapQueue queue(ws);
+    return kahnTopoOrder(inst, priorities, ws, order, first, queue);
+}
+
+// Hash of the bit patterns of the priorities (FNV-1a on 64-bit words)
+unsigned long long hashPriorities(const std::vector<double>& priorities) {
+    unsigned long long h = 1469598103934665603ULL;
+    for (double p : priorities) {
+        unsigned long long bits;
+        std::memcpy(&bits, &p, sizeof(bits));
+        h = (h ^ bits ^ (bits >> 32)) * 1099511628211ULL;
+    }
+    return h;
+}
+
+// Cached topological order for these priorities, nullptr if none
+const TopoOrderEntry* findTopoOrder(const ScheduleWorkspace& ws, const std::vector<double>& priorities, unsigned long long hash) {
+    for (const TopoOrderEntry& entry : ws.topo_cache) {
+        if (entry.hash == hash && entry.order.size() == priorities.size() && entry.priorities == priorities) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+void storeTopoOrder(ScheduleWorkspace& ws, const std::vector<double>& priorities, unsigned long long hash, const std::vector<int>& order) {
+    TopoOrderEntry& entry = ws.topo_cache[ws.topo_cache_next];
+    ws.topo_cache_next = (ws.topo_cache_next + 1) % ScheduleWorkspace::TOPO_CACHE_SIZE;
+    entry.hash = hash;
+    entry.priorities = priorities;
+    entry.order = order;
+}
+
+// Stages 1 and 2 of a staged evaluation, from the allocation alone (no ordering, no server contention).
+// Only rejects candidates that the timing simulation would reject too, and returns NOT_SCHEDULED otherwise.
+// The failed task is the one the check stopped at (for capacities, the last task counted on the server).
+EvalResult screenCandidate(const CompiledInstance& inst, const Candidate& candidate, ScheduleWorkspace& ws) {
+    const int N = inst.task_count;
+    const int S = inst.server_count;
+
+    // Stage 1: servers and capacities, O(N + S)
+    for (int s = 0; s < S; ++s) {
+        ws.screen_memory_left[s] = inst.server_memory[s];
+        ws.screen_utilization_left[s] = inst.server_utilization[s];
+        ws.screen_task_count[s] = 0;
+        ws.screen_last_task[s] = -1;
+    }
+    for (int i = 0; i < N; ++i) {
+        const int fixed_server = inst.fixed_server[i];
+        const int server_idx = fixed_server >= 0 ? fixed_server : candidate.server_indices[i];
+        if (server_idx < 0 || server_idx >= S || (inst.server_is_mist[server_idx] && fixed_server < 0)) {
+            ws.rejections.capacity++;
+            return EvalResult(ScheduleState::CANDIDATE_ERROR, i);
+        }
+        ws.screen_memory_left[server_idx] -= inst.M[i];
+        ws.screen_utilization_left[server_idx] -= inst.u[i];
+        ws.screen_last_task[server_idx] = i;
+        if (inst.server_is_mist[server_idx] && ++ws.screen_task_count[server_idx] > 1) {
+            ws.rejections.capacity++;
+            return EvalResult(ScheduleState::CANDIDATE_ERROR, i);
+        }
+    }
+    for (int s = 0; s < S; ++s) {
+        // The simulation subtracts utilizations in another order, so rounding differences are left to it
+        if (ws.screen_utilization_left[s] < -1e-9) {
+            ws.rejections.capacity++;
+            return EvalResult(ScheduleState::UTILIZATION_UNFEASIBLE, ws.screen_last_task[s]);
+        }
+        if (ws.screen_memory_left[s] < 0) {
+            ws.rejections.capacity++;
+            return EvalResult(ScheduleState::MEMORY_UNFEASIBLE, ws.screen_last_task[s]);
+        }
+    }
+
+    // Stage 2: earliest finish of each task with the communication delays of its allocation, O(N + E)
+    for (int idx : inst.graph_order) {
+        const int server_idx = inst.fixed_server[idx] >= 0 ? inst.fixed_server[idx] : candidate.server_indices[idx];
+        long long earliest = inst.a[idx];
+        for (int k = inst.pred_offsets[idx]; k < inst.pred_offsets[idx + 1]; ++k) {
+            const int pidx = inst.pred_idxs[k];
+            const int pred_server = inst.fixed_server[pidx] >= 0 ? inst.fixed_server[pidx] : candidate.server_indices[pidx];
+            const int delay = pred_server == server_idx ? 0 : inst.getDelay(pred_server, server_idx);
+            if (delay == INT_MAX) {
+                ws.rejections.deadline++;
+                return EvalResult(ScheduleState::PRECEDENCES_ERROR, idx);
+            }
+            earliest = std::max(earliest, ws.screen_finish[pidx] + delay);
+        }
+        ws.screen_finish[idx] = earliest + inst.C[idx];
+        if (inst.D[idx] > 0 && ws.screen_finish[idx] > (long long)inst.a[idx] + inst.D[idx]) {
+            ws.rejections.deadline++;
+            return EvalResult(ScheduleState::DEADLINE_MISSED, idx);
+        }
+    }
+
+    return EvalResult(ScheduleState::NOT_SCHEDULED);
+}
+
+// Counts an infeasible outcome of the timing simulation
+inline EvalResult countSimulation(ScheduleWorkspace& ws, const EvalResult& result) {
+    if (result.state != ScheduleState::SCHEDULED && result.state != ScheduleState::BOUND_EXCEEDED) {
+        ws.rejections.simulation++;
+    }
+    return result;
+}
+
+// Lower bound of the objective once the tasks up to topo position `pos` are placed: remaining tasks
+// finish no earlier than their min_finish, add no delay and run on the cheapest server.
+// It never decreases with pos (for non negative weights) and equals the objective at the last position.
+inline double objectiveLowerBound(const CompiledInstance& inst, const ScheduleWorkspace& ws, const ObjectiveBound& bound, int pos,
+                                  long long finish_time_sum, long long delay_cost, long long processors_cost) {
+    const long long remaining = (long long)inst.task_count - pos - 1;
+    return bound.alpha * static_cast<double>(finish_time_sum + inst.min_finish_sum - ws.prefix_min_finish[pos])
+         + bound.beta * static_cast<double>(delay_cost)
+         + bound.gamma * static_cast<double>(processors_cost + remaining * inst.min_server_cost);
+}
+
+// Schedules the tasks of ws.topo_order from position `first` on. The tasks before it must be placed
+// already, with the server buffers holding the state they left behind.
+EvalResult simulateFrom(const CompiledInstance& inst, const Candidate& candidate, ScheduleWorkspace& ws, int first, const ObjectiveBound& bound) {
+    const int N = inst.task_count;
+    const int S = inst.server_count;
+
+    // Objective components of the unchanged prefix
+    long long finish_time_sum = first > 0 ? ws.prefix_finish_sum[first - 1] : 0;
+    long long processors_cost = first > 0 ? ws.prefix_processors_cost[first - 1] : 0;
+    long long delay_cost = first > 0 ? ws.prefix_delay_cost[first - 1] : 0;
+    int schedule_span = first > 0 ? ws.prefix_span[first - 1] : 0;
+    ws.placed_count = first;
+    ws.overflow_pos = -1;
+
+    const bool bounded = bound.isSet();
+    if (bounded && first > 0
+        && objectiveLowerBound(inst, ws, bound, first - 1, finish_time_sum, delay_cost, processors_cost) > bound.value) {
+        // The unchanged prefix already exceeds the bound
+        return EvalResult(ScheduleState::BOUND_EXCEEDED);
+    }
+
+    // For each task in topo order compute earliest start
+    for (int pos = first; pos < N; ++pos) {
+        const int idx = ws.topo_order[pos];
+
+        // Find assigned server
+        const int fixed_server = inst.fixed_server[idx];
+        const int server_idx = fixed_server >= 0 ? fixed_server : candidate.server_indices[idx];
+
+        if(server_idx < 0 || server_idx >= S){
+            return EvalResult(ScheduleState::CANDIDATE_ERROR, idx);
+        }
+        
+        if (inst.server_is_mist[server_idx] && fixed_server < 0) {
+            return EvalResult(ScheduleState::CANDIDATE_ERROR, idx);
+        }
+
+        // earliest start considering activation time a
+        long long earliest = (long long)inst.a[idx];
+
+        // predecessors constraints (topo order ensures they have been scheduled already)
+        for (int k = inst.pred_offsets[idx]; k < inst.pred_offsets[idx + 1]; ++k) {
+            const int pidx = inst.pred_idxs[k];
+            const long long pred_finish = (long long)ws.finish_times[pidx];
+            const int pred_server = ws.server_of[pidx];
+
+            // get communication delay
+            if (pred_server == server_idx) {
+                // same server: no network delay
+                earliest = std::max(earliest, pred_finish);
+            } else {
+                const int delay = inst.getDelay(pred_server, server_idx);
+                if (delay == INT_MAX) {
+                    // disconnected servers -> infeasible
+                    return EvalResult(ScheduleState::PRECEDENCES_ERROR, idx);
+                }
+                earliest = std::max(earliest, pred_finish + (long long)delay);
+                delay_cost += delay;
+            }
+        }
+        
+        // server availability constraint
+        earliest = std::max(earliest, ws.server_ready[server_idx]);
+
+        // Now set start time (cast to int safely, but check overflow)
+        if (earliest > INT_MAX){
+            return EvalResult(ScheduleState::CANDIDATE_ERROR, idx); // too large
+        }
+        const int start_time = (int)earliest;
+        const int finish_time = start_time + inst.C[idx];
+        ws.start_times[idx] = start_time;
+        ws.finish_times[idx] = finish_time;
+        finish_time_sum += finish_time;
+        schedule_span = std::max(schedule_span, finish_time);
+
+        // Check deadline if D > 0. Interpret deadline as relative to activation a: finish <= a + D
+        const int D = inst.D[idx];
+        if (D > 0) {
+            const long long latest_allowed_finish = (long long)inst.a[idx] + (long long)D;
+            if ((long long)finish_time > latest_allowed_finish) {
+                // misses deadline -> infeasible
+                return EvalResult(ScheduleState::DEADLINE_MISSED, idx);
+            }
+        }
+        
+        // Update server ready time (server executes tasks sequentially)
+        const long long server_ready_before = ws.server_ready[server_idx];
+        if (!inst.server_is_mist[server_idx]) {
+            ws.server_ready[server_idx] = (long long)finish_time; // next available time slot
+        }else{
+            if (ws.server_task_count[server_idx] > 0) {
+                return EvalResult(ScheduleState::CANDIDATE_ERROR, idx);
+            }
+        }
+
+        // Place task on server, remembering the previous server state so the placement can be undone
+        ws.prev_server_ready[pos] = server_ready_before;
+        ws.prev_memory_left[pos] = ws.server_memory_left[server_idx];
+        ws.prev_utilization_left[pos] = ws.server_utilization_left[server_idx];
+        ws.server_of[idx] = server_idx;
+        ws.server_task_count[server_idx]++;
+        ws.placed_count++;
+        processors_cost += inst.server_cost[server_idx];
+        ws.prefix_finish_sum[pos] = finish_time_sum;
+        ws.prefix_processors_cost[pos] = processors_cost;
+        ws.prefix_delay_cost[pos] = delay_cost;
+        ws.prefix_span[pos] = schedule_span;
+        ws.prefix_min_finish[pos] = (pos > 0 ? ws.prefix_min_finish[pos - 1] : 0) + inst.min_finish[idx];
+        ws.server_utilization_left[server_idx] -= inst.u[idx];
+        ws.server_memory_left[server_idx] -= inst.M[idx];
+        if (ws.server_utilization_left[server_idx] < 0.0) {
+            ws.overflow_pos = pos;
+            return EvalResult(ScheduleState::UTILIZATION_UNFEASIBLE, idx); // over-utilization -> infeasible
+        }
+        if (ws.server_memory_left[server_idx] < 0) {
+            ws.overflow_pos = pos;
+            return EvalResult(ScheduleState::MEMORY_UNFEASIBLE, idx); // out of memory -> infeasible
+        }
+
+        // Stop as soon as the schedule cannot stay within the bound
+        if (bounded && objectiveLowerBound(inst, ws, bound, pos, finish_time_sum, delay_cost, processors_cost) > bound.value) {
+            return EvalResult(ScheduleState::BOUND_EXCEEDED);
+        }
+    }
+
+    EvalResult res(ScheduleState::SCHEDULED);
+    res.finish_time_sum = (int)finish_time_sum;
+    res.processors_cost = (int)processors_cost;
+    res.delay_cost = (int)delay_cost;
+    res.schedule_span = schedule_span;
+    return res;
+}
+
+// Checks shared by every full evaluation, and sizes the workspace. Returns NOT_SCHEDULED if the candidate can be evaluated.
+EvalResult beginEvaluation(const CompiledInstance& inst, const Candidate& candidate, ScheduleWorkspace& ws) {
+    ws.cache_valid = false;
+    ws.screened = false;
+    ws.placed_count = 0;
+
+    const int N = inst.task_count;
+    if ((int)candidate.server_indices.size() != N || (int)candidate.priorities.size() != N) {
+        // invalid candidate size
+        return EvalResult(ScheduleState::CANDIDATE_ERROR);
+    }
+
+    if (inst.graph_state != ScheduleState::NOT_SCHEDULED) {
+        // unresolved predecessor or successor references -> infeasible input
+        return EvalResult(inst.graph_state);
+    }
+
+    ws.prepare(inst);
+    return EvalResult(ScheduleState::NOT_SCHEDULED);
+}
+
+// Topological order and timing simulation of a candidate from scratch (after beginEvaluation)
+EvalResult simulateCandidate(const CompiledInstance& inst, const Candidate& candidate, ScheduleWorkspace& ws, const ObjectiveBound& bound, ReadyQueueType ready_queue) {
+    const int N = inst.task_count;
+
+    // 1) Topological order of the tasks, ties broken by priority (reused if these priorities were seen recently)
+    const unsigned long long hash = hashPriorities(candidate.priorities);
+    if (const TopoOrderEntry* cached = findTopoOrder(ws, candidate.priorities, hash)) {
+        ws.topo_order = cached->order;
+    } else {
+        if (!completeTopoOrder(inst, candidate.priorities, ws, ws.topo_order, 0, ready_queue)){
+            return EvalResult(ScheduleState::CYCLE_ERROR);
+        }
+        storeTopoOrder(ws, candidate.priorities, hash, ws.topo_order);
+    }
+    for (int k = 0; k < N; ++k) {
+        ws.topo_pos[ws.topo_order[k]] = k;
+    }
+
+    // 2) Schedule tasks in topo order.
+    // Keep track of server availability time (when server becomes free) and remaining resources
+    const int S = inst.server_count;
+    for (int s = 0; s < S; ++s) {
+        ws.server_ready[s] = 0LL; // initially all servers ready at time 0
+        ws.server_memory_left[s] = inst.server_memory[s];
+        ws.server_utilization_left[s] = inst.server_utilization[s];
+        ws.server_task_count[s] = 0;
+    }
+    std::fill(ws.server_of.begin(), ws.server_of.end(), -1);
+
+    ws.last_server_indices = candidate.server_indices;
+    ws.last_priorities = candidate.priorities;
+    ws.cache_valid = true;
+
+    return countSimulation(ws, simulateFrom(inst, candidate, ws, 0, bound));
+}
+
+} // namespace
+
+EvalResult Scheduler::evaluate(const Candidate& candidate, ScheduleWorkspace& ws, const ObjectiveBound& bound) const {
+    // Computes the schedule of a candidate using only the compiled instance and the workspace buffers.
+    // Start/finish times and the server of each task are left in the workspace, and the objective
+    // components (finish time sum, delay cost, processors cost) are accumulated in the same pass.
+    // Candidate contains:
+    // - server_indices: vector<int> of size N (number of tasks), server index assigned to each task
+    // - priorities: vector<double> of size N, priority value for each task (higher runs first among ready tasks)
+    // If a bound is given, evaluation stops with BOUND_EXCEEDED once the objective is known to exceed it.
+    // The scheduler itself is not modified, so several threads can evaluate concurrently with their own workspaces.
+    // Nothing is logged on this path (the shared debug stream is not thread-safe): failures are only reported
+    // through the state and failed task of the result, and schedule() logs them.
+
+    const EvalResult checked = beginEvaluation(instance, candidate, ws);
+    if (checked.state != ScheduleState::NOT_SCHEDULED) {
+        return checked;
+    }
+
+    // 0) Staged evaluation: cheap checks of the allocation first. A rejection leaves no simulation state in ws
+    if (staged_rejection) {
+        const EvalResult screened = screenCandidate(instance, candidate, ws);
+        if (screened.state != ScheduleState::NOT_SCHEDULED) {
+            ws.screened = true;
+            return screened;
+        }
+    }
+
+    return simulateCandidate(instance, candidate, ws, bound, ready_queue);
+};
+
+EvalResult Scheduler::evaluateUnstaged(const Candidate& candidate, ScheduleWorkspace& ws, const ObjectiveBound& bound) const {
+    // Same as evaluate() without the staged screening, for callers that need the state the timing
+    // simulation leaves in ws (e.g. to repair a candidate the screening rejected).
+    const EvalResult checked = beginEvaluation(instance, candidate, ws);
+    if (checked.state != ScheduleState::NOT_SCHEDULED) {
+        return checked;
+    }
+    return simulateCandidate(instance, candidate, ws, bound, ready_queue);
+};
+
+EvalResult Scheduler::evaluateIncremental(const Candidate& candidate, ScheduleWorkspace& ws, const ObjectiveBound& bound) const {
+    // Re-evaluates only the part of the schedule affected by the entries of the candidate that differ
+    // from the last one evaluated with ws. The tasks before the first affected topo position keep their
+    // times, so the result is identical to evaluate() while skipping the unchanged prefix.
+
+    const CompiledInstance& inst = instance;
+    const int N = inst.task_count;
+    if (!ws.cache_valid || (int)ws.topo_pos.size() != N
+        || (int)candidate.server_indices.size() != N || (int)candidate.priorities.size() != N) {
+        return evaluate(candidate, ws, bound);
+    }
+
+    // No staged screening here: its O(N + E) pass would cost more than the changed suffix it could skip
+
+    // Nothing after the task that made the last candidate fail has been scheduled. A task that overflowed
+    // a server was placed before the check, so it is placed again to repeat the check.
+    int restart = ws.overflow_pos >= 0 ? ws.overflow_pos : ws.placed_count;
+    // Up to this position the ready queue of Kahn's algorithm only holds tasks with unchanged priority
+    int order_from = N;
+    for (int i = 0; i < N; ++i) {
+        if (candidate.priorities[i] != ws.last_priorities[i]) {
+            // A task only competes for its position once all its predecessors have been ordered
+            int ready_pos = 0;
+            for (int k = inst.pred_offsets[i]; k < inst.pred_offsets[i + 1]; ++k) {
+                ready_pos = std::max(ready_pos, ws.topo_pos[inst.pred_idxs[k]] + 1);
+            }
+            order_from = std::min(order_from, ready_pos);
+        }
+        if (inst.fixed_server[i] < 0 && candidate.server_indices[i] != ws.last_server_indices[i]) {
+            restart = std::min(restart, ws.topo_pos[i]);
+        }
+    }
+
+    // Recompute the order after order_from (or take it from the cache) and find where it departs from the previous one
+    int diverge = N;
+    if (order_from < N) {
+        const unsigned long long hash = hashPriorities(candidate.priorities);
+        if (const TopoOrderEntry* cached = findTopoOrder(ws, candidate.priorities, hash)) {
+            ws.next_topo = cached->order; // Same prefix up to order_from as the order it would be completed from
+        } else {
+            ws.next_topo.assign(ws.topo_order.begin(), ws.topo_order.begin() + order_from);
+            if (!completeTopoOrder(inst, candidate.priorities, ws, ws.next_topo, order_from, ready_queue)) {
+                return evaluate(candidate, ws, bound);
+            }
+            storeTopoOrder(ws, candidate.priorities, hash, ws.next_topo);
+        }
+        diverge = order_from;
+        while (diverge < N && ws.next_topo[diverge] == ws.topo_order[diverge]) {
+            ++diverge;
+        }
+        restart = std::min(restart, diverge);
+    }
+
+    // Undo the placements from the restart position on (in the previous order)
+    for (int pos = ws.placed_count - 1; pos >= restart; --pos) {
+        const int idx = ws.topo_order[pos];
+        const int server_idx = ws.server_of[idx];
+        ws.server_ready[server_idx] = ws.prev_server_ready[pos];
+        ws.server_memory_left[server_idx] = ws.prev_memory_left[pos];
+        ws.server_utilization_left[server_idx] = ws.prev_utilization_left[pos];
+        ws.server_task_count[server_idx]--;
+        ws.server_of[idx] = -1;
+    }
+
+    if (diverge < N) {
+        std::swap(ws.topo_order, ws.next_topo);
+        for (int k = diverge; k < N; ++k) {
+            ws.topo_pos[ws.topo_order[k]] = k;
+        }
+    }
+
+    ws.last_server_indices = candidate.server_indices;
+    ws.last_priorities = candidate.priorities;
+
+    return countSimulation(ws, simulateFrom(inst, candidate, ws, restart, bound));
+};
+
+void Scheduler::evaluateBatch(const std::vector<Candidate>& candidates, std::vector<EvalResult>& results, const ObjectiveBound& bound) {
+    evaluateBatch(candidates, results, &bound, 0); // The same bound for every candidate, without a vector of copies
+};
+
+void Scheduler::evaluateBatch(const std::vector<Candidate>& candidates, std::vector<EvalResult>& results, const std::vector<ObjectiveBound>& bounds) {
+    if (bounds.size() < candidates.size()) {
+        utils::throw_runtime_error("evaluateBatch: one bound per candidate expected");
+    }
+    evaluateBatch(candidates, results, bounds.data(), 1);
+};
+
+void Scheduler::evaluateBatch(const std::vector<Candidate>& candidates, std::vector<EvalResult>& results, const ObjectiveBound* bounds, size_t bound_stride) {
+    // Candidates are split in contiguous chunks among the threads of the OpenMP pool, each thread using
+    // its own workspace. A result only depends on its candidate, so it is the same for any thread count:
+    // with staged rejection, every candidate is screened, not only the ones evaluate() is called for when
+    // the workspace holds no schedule yet (the screening buffers are separate from the incremental state).
+    // Not meant to be called concurrently (the per-thread workspaces belong to the scheduler).
+
+    const int count = (int)candidates.size();
+    results.resize(count);
+
+#ifdef _OPENMP
+    const int threads = omp_get_max_threads();
+#else
+    const int threads = 1;
+#endif
+    if ((int)batch_workspaces.size() < threads) {
+        batch_workspaces.resize(threads);
+    }
+
+    #pragma omp parallel for schedule(static) if(count > 1)
+    for (int c = 0; c < count; ++c) {
+#ifdef _OPENMP
+        ScheduleWorkspace& ws = batch_workspaces[omp_get_thread_num()];
+#else
+        ScheduleWorkspace& ws = batch_workspaces[0];
+#endif
+        const Candidate& candidate = candidates[c];
+        if (staged_rejection && ws.cache_valid && (int)candidate.server_indices.size() == instance.task_count
+            && (int)candidate.priorities.size() == instance.task_count) {
+            const EvalResult screened = screenCandidate(instance, candidate, ws);
+            if (screened.state != ScheduleState::NOT_SCHEDULED) {
+                results[c] = screened;
+                continue;
+            }
+        }
+        results[c] = evaluateIncremental(candidate, ws, bounds[c * bound_stride]);
+    }
+};
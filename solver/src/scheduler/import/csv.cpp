@@ -130,16 +130,22 @@ void Scheduler::importScheduleFromCSV(const std::string& csv_data) {
         int start_time = std::stoi(start_time_str);
 
         Task& t = tasks[task_idx];
-        t.setStartTime(start_time);
+        start_times[task_idx] = start_time;
+        finish_times[task_idx] = start_time + t.getC();
+        task_server_idxs[task_idx] = server_idx;
         // If this task is assigned to a MIST server, mark it as fixed allocation
         if (servers[server_idx].getType() == ServerType::Mist) {
             t.setFixedAllocationId(servers[server_idx].getId());
             t.setFixedAllocationInternalId(server_idx);
         }
-        servers[server_idx].pushBackTask(t);
+        servers[server_idx].pushBackTask(task_idx, t.getM(), t.getU(), finish_times[task_idx]);
         
         line_number++;
     }
 
+    // Fixed allocations may have changed, refresh the flat copy used by schedule()
+    compileInstance();
+
     state = ScheduleState::SCHEDULED;
+    result = summarizeSchedule();
 };
\ No newline at end of file
@@ -115,8 +115,6 @@ void Scheduler::loadScheduleFromDatFile(const std::string& file_path) {
                 task.setFixedAllocationInternalId(serverInternalIdx);
             }
 
-            task.setStartTime(0); // Finish time will be start + C - 1, but not used yet
-
             taskIdMap[taskIndex] = task.getId();
             taskIndexMap[taskIndex] = i;
             tasks.push_back(task);
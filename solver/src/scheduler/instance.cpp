@@ -0,0 +1,159 @@
+#include "scheduler.h"
+
+void Scheduler::compileInstance() {
+    // Builds the flat representation used by schedule(): task attributes as plain arrays,
+    // precedences as CSR lists of dense indices and the delay matrix as a single row-major block.
+    // Task references are resolved here once, so the hot path never needs ids or hash maps.
+
+    const int N = (int)tasks.size();
+    const int S = (int)servers.size();
+
+    instance = CompiledInstance();
+    instance.task_count = N;
+    instance.server_count = S;
+
+    std::unordered_map<int,int> taskIdToInternalIdx;
+    taskIdToInternalIdx.reserve(N);
+    for (int i = 0; i < N; ++i) {
+        taskIdToInternalIdx[tasks[i].getInternalIdx()] = i;
+    }
+
+    instance.C.resize(N);
+    instance.D.resize(N);
+    instance.a.resize(N);
+    instance.M.resize(N);
+    instance.u.resize(N);
+    instance.fixed_server.resize(N);
+    instance.pred_offsets.assign(N + 1, 0);
+    instance.succ_offsets.assign(N + 1, 0);
+
+    for (int i = 0; i < N; ++i) {
+        const Task& t = tasks[i];
+        instance.C[i] = t.getC();
+        instance.D[i] = t.getD();
+        instance.a[i] = t.getA();
+        instance.M[i] = t.getM();
+        instance.u[i] = t.getU();
+        instance.fixed_server[i] = t.hasFixedAllocation() ? t.getFixedAllocationInternalIdx() : -1;
+
+        instance.pred_offsets[i] = (int)instance.pred_idxs.size();
+        for (int pred_internal : t.getPredecessorInternalIdxs()) {
+            auto it = taskIdToInternalIdx.find(pred_internal);
+            if (it == taskIdToInternalIdx.end()) {
+                utils::dbg << "Task " << t.getId() << " has unknown predecessor internal index " << pred_internal << "\n";
+                instance.graph_state = ScheduleState::PRECEDENCES_ERROR;
+                continue;
+            }
+            instance.pred_idxs.push_back(it->second);
+        }
+
+        instance.succ_offsets[i] = (int)instance.succ_idxs.size();
+        for (int succ_internal : t.getSuccessorInternalIdxs()) {
+            auto it = taskIdToInternalIdx.find(succ_internal);
+            if (it == taskIdToInternalIdx.end()) {
+                utils::dbg << "Task " << t.getId() << " has unknown successor internal index " << succ_internal << "\n";
+                instance.graph_state = ScheduleState::SUCCESSORS_ERROR;
+                continue;
+            }
+            instance.succ_idxs.push_back(it->second);
+        }
+    }
+    instance.pred_offsets[N] = (int)instance.pred_idxs.size();
+    instance.succ_offsets[N] = (int)instance.succ_idxs.size();
+
+    instance.server_is_mist.resize(S);
+    instance.server_memory.resize(S);
+    instance.server_cost.resize(S);
+    instance.server_utilization.resize(S);
+    instance.delay.assign((size_t)S * S, INT_MAX);
+    for (int s = 0; s < S; ++s) {
+        const Server& srv = servers[s];
+        instance.server_is_mist[s] = srv.getType() == ServerType::Mist;
+        instance.server_memory[s] = srv.getMemory();
+        instance.server_cost[s] = srv.getCost();
+        instance.server_utilization[s] = srv.getUtilization();
+    }
+    instance.min_server_cost = S > 0 ? *std::min_element(instance.server_cost.begin(), instance.server_cost.end()) : 0;
+    for (int from = 0; from < (int)delay_matrix.size() && from < S; ++from) {
+        for (int to = 0; to < (int)delay_matrix[from].size() && to < S; ++to) {
+            instance.delay[from * S + to] = delay_matrix[from][to];
+        }
+    }
+
+    // Earliest finish of each task along the precedence graph, used to bound the objective of partial schedules.
+    // Tasks on a cycle are never released and keep a + C (such graphs are rejected when scheduling).
+    instance.min_finish.resize(N);
+    std::vector<int> pending(N);
+    std::vector<int>& released = instance.graph_order;
+    released.clear();
+    released.reserve(N);
+    for (int i = 0; i < N; ++i) {
+        instance.min_finish[i] = instance.a[i] + instance.C[i];
+        pending[i] = instance.pred_offsets[i + 1] - instance.pred_offsets[i];
+        if (pending[i] == 0) released.push_back(i);
+    }
+    for (size_t k = 0; k < released.size(); ++k) {
+        const int u = released[k];
+        int earliest = instance.a[u];
+        for (int e = instance.pred_offsets[u]; e < instance.pred_offsets[u + 1]; ++e) {
+            earliest = std::max(earliest, instance.min_finish[instance.pred_idxs[e]]);
+        }
+        instance.min_finish[u] = earliest + instance.C[u];
+        for (int e = instance.succ_offsets[u]; e < instance.succ_offsets[u + 1]; ++e) {
+            if (--pending[instance.succ_idxs[e]] == 0) released.push_back(instance.succ_idxs[e]);
+        }
+    }
+    instance.min_finish_sum = 0;
+    for (int i = 0; i < N; ++i) {
+        instance.min_finish_sum += instance.min_finish[i];
+    }
+
+    // Servers each task may be allocated to. A fixed task only has its own server. A movable task excludes MIST
+    // servers, servers with less memory or utilization than it needs, servers unreachable from a fixed
+    // predecessor or that cannot reach a fixed successor, and servers where the delay from a fixed predecessor
+    // already makes it miss its deadline. A task left without servers (the instance is infeasible) keeps all
+    // the non-MIST ones, so operators can still move it.
+    instance.allowed_words = (S + 63) / 64;
+    instance.allowed_mask.assign((size_t)N * instance.allowed_words, 0ULL);
+    instance.allowed_offsets.assign(N + 1, 0);
+    instance.allowed_servers.clear();
+    for (int i = 0; i < N; ++i) {
+        const size_t first = instance.allowed_servers.size();
+        const int fixed = instance.fixed_server[i];
+        if (fixed >= 0) {
+            if (fixed < S) instance.allowed_servers.push_back(fixed);
+        } else {
+            const long long latestFinish = instance.D[i] > 0 ? (long long)instance.a[i] + instance.D[i] : LLONG_MAX;
+            for (int s = 0; s < S; ++s) {
+                if (instance.server_is_mist[s] || instance.M[i] > instance.server_memory[s] || instance.u[i] > instance.server_utilization[s]) continue;
+                bool allowed = true;
+                for (int e = instance.pred_offsets[i]; e < instance.pred_offsets[i + 1] && allowed; ++e) {
+                    const int p = instance.pred_idxs[e];
+                    const int ps = instance.fixed_server[p];
+                    if (ps < 0 || ps >= S) continue;
+                    const int delay = ps == s ? 0 : instance.getDelay(ps, s);
+                    allowed = delay != INT_MAX
+                        && std::max((long long)instance.a[i], (long long)instance.min_finish[p] + delay) + instance.C[i] <= latestFinish;
+                }
+                for (int e = instance.succ_offsets[i]; e < instance.succ_offsets[i + 1] && allowed; ++e) {
+                    const int qs = instance.fixed_server[instance.succ_idxs[e]];
+                    if (qs < 0 || qs >= S) continue;
+                    allowed = qs == s || instance.getDelay(s, qs) != INT_MAX;
+                }
+                if (allowed) instance.allowed_servers.push_back(s);
+            }
+        }
+        if (instance.allowed_servers.size() == first) {
+            for (int s = 0; s < S; ++s) {
+                if (!instance.server_is_mist[s]) instance.allowed_servers.push_back(s);
+            }
+        }
+        for (size_t k = first; k < instance.allowed_servers.size(); ++k) {
+            const int s = instance.allowed_servers[k];
+            instance.allowed_mask[(size_t)i * instance.allowed_words + s / 64] |= 1ULL << (s % 64);
+        }
+        instance.allowed_offsets[i + 1] = (int)instance.allowed_servers.size();
+    }
+
+    utils::dbg << "Compiled instance: " << N << " tasks, " << instance.pred_idxs.size() << " precedences, " << S << " servers.\n";
+};
@@ -20,6 +20,7 @@ std::string ScheduleState::toString() const {
         case DEADLINE_MISSED: return "Deadline missed: one or more tasks miss their deadlines";
         case UTILIZATION_UNFEASIBLE: return "Utilization unfeasible: one or more servers over-utilized";
         case MEMORY_UNFEASIBLE: return "Memory unfeasible: one or more servers out of memory";
+        case BOUND_EXCEEDED: return "Bound exceeded: objective above the requested upper bound";
         default: return "Unknown schedule state";
     }
 };
@@ -31,8 +32,10 @@ std::string Scheduler::printTxt() const {
     oss << "Scheduler Information:\n\n";
     
     oss << "Tasks (" << tasks.size() << "):\n\n";
-    for (const auto& task : tasks) {
-        oss << task.print();
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        oss << tasks[i].print();
+        oss << "Start time: " << start_times[i] << "\n";
+        oss << "Finish time: " << finish_times[i] << "\n";
         oss << "---------------------\n";
     }
 
@@ -40,6 +43,10 @@ std::string Scheduler::printTxt() const {
     oss << "Servers (" << servers.size() << "):\n\n";
     for (const auto& server : servers) {
         oss << server.print();
+        for (int task_idx : server.getAssignedTasks()) {
+            const Task& task = tasks[task_idx];
+            oss << "  - " << task.getLabel() << " (ID: " << task.getId() << ", Start: " << start_times[task_idx] << ", Finish: " << finish_times[task_idx] << ")\n";
+        }
         oss << "---------------------\n";
     }
 
@@ -93,32 +100,27 @@ std::string Scheduler::printTxt() const {
         for (const auto& server : servers) {
             oss << "Server: " << server.getLabel() << " (" << server.getId() << ")\n";
             oss << "Assigned Tasks: ";
-            for (const auto& task : server.getAssignedTasks()) {
-                //oss << task.getId() << " ";
-                oss << task.getLabel() << " ";
+            for (int task_idx : server.getAssignedTasks()) {
+                //oss << tasks[task_idx].getId() << " ";
+                oss << tasks[task_idx].getLabel() << " ";
             }
             oss << "\n---------------------\n";
         }
 
         oss << "\n" << "####################\n";
         oss << "Tasks allocation by task:\n";
-        for (const auto& task : tasks) {
+        for (size_t i = 0; i < tasks.size(); ++i) {
+            const Task& task = tasks[i];
             oss << "Task: " << task.getLabel() << " (" << task.getId() << ")\n";
-            // Find server hosting this task
+            // Server hosting this task
             std::string server_info = "Not allocated";
-            for (const auto& server : servers) {
-                const auto& assigned_tasks = server.getAssignedTasks();
-                auto it = std::find_if(assigned_tasks.begin(), assigned_tasks.end(), [&task](const Task& at){
-                    return at.getInternalIdx() == task.getInternalIdx();
-                });
-                if (it != assigned_tasks.end()) {
-                    server_info = server.getLabel() + " (" + server.getId() + ")";
-                    break;
-                }
+            const int server_idx = task_server_idxs[i];
+            if (server_idx >= 0) {
+                server_info = servers[server_idx].getLabel() + " (" + servers[server_idx].getId() + ")";
             }
             oss << "Assigned Server: " << server_info << "\n";
-            oss << "Start Time: " << task.getStartTime() << "\n";
-            oss << "Finish Time: " << task.getFinishTime() << "\n";
+            oss << "Start Time: " << start_times[i] << "\n";
+            oss << "Finish Time: " << finish_times[i] << "\n";
             oss << "---------------------\n";
         }
     }
@@ -130,7 +132,8 @@ std::string Scheduler::printJSON() const {
     nlohmann::json j;
 
     j["tasks"] = nlohmann::json::array();
-    for (const auto& task : tasks) {
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        const Task& task = tasks[i];
         nlohmann::json jt;
         jt["id"] = task.getId();
         jt["type"] = (task.getType() == TaskType::Mist) ? "Mist" : "Regular";
@@ -140,8 +143,8 @@ std::string Scheduler::printJSON() const {
         jt["M"] = task.getM();
         jt["a"] = task.getA();
         jt["u"] = task.getU();
-        jt["start_time"] = task.getStartTime();
-        jt["finish_time"] = task.getFinishTime();
+        jt["start_time"] = start_times[i];
+        jt["finish_time"] = finish_times[i];
         jt["predecessors"] = task.getPredecessors();
         j["tasks"].push_back(jt);
     }
@@ -157,8 +160,8 @@ std::string Scheduler::printJSON() const {
         js["utilization"] = server.getUtilization();
         js["last_slot"] = server.getLastSlot();
         js["assigned_tasks"] = nlohmann::json::array();
-        for (const auto& task : server.getAssignedTasks()) {
-            js["assigned_tasks"].push_back(task.getId());
+        for (int task_idx : server.getAssignedTasks()) {
+            js["assigned_tasks"].push_back(tasks[task_idx].getId());
         }
         j["servers"].push_back(js);
     }
@@ -207,12 +210,11 @@ std::string Scheduler::printTable(char separator) const {
     oss << "task,server,start,finish\n";
 
     for (const auto& server : servers) {
-        const auto& tasks = server.getAssignedTasks();
-        for (const auto& task : tasks) {
-            oss << task.getId() << separator
+        for (int task_idx : server.getAssignedTasks()) {
+            oss << tasks[task_idx].getId() << separator
                 << server.getId() << separator
-                << task.getStartTime() << separator
-                << task.getFinishTime() << "\n";
+                << start_times[task_idx] << separator
+                << finish_times[task_idx] << "\n";
         }
     }
 
@@ -51,18 +51,11 @@ Server Server::fromJSON(const nlohmann::json& j) {
     return server;
 };
 
-void Server::pushBackTask(const Task& task) { 
-    assigned_tasks.push_back(task); 
-    available_utilization -= task.getU(); 
-    available_memory -= task.getM(); 
-    last_slot = task.getFinishTime(); 
-};
-
-void Server::pushFrontTask(const Task& task) { 
-    assigned_tasks.push_front(task); 
-    available_utilization -= task.getU(); 
-    available_memory -= task.getM();
-    last_slot = std::max(last_slot, task.getFinishTime()); 
+void Server::pushBackTask(int task_idx, int task_memory, double task_utilization, int finish_time) { 
+    assigned_tasks.push_back(task_idx); 
+    available_utilization -= task_utilization; 
+    available_memory -= task_memory; 
+    last_slot = finish_time; 
 };
 
 void Server::clearTasks() { 
@@ -94,9 +87,6 @@ std::string Server::print() const {
     oss << "Last Slot: " << last_slot << "\n";
     
     oss << "Assigned Tasks: " << assigned_tasks.size() << "\n";
-    for (const auto& task : assigned_tasks) {
-        oss << "  - " << task.getLabel() << " (ID: " << task.getId() << ", Start: " << task.getStartTime() << ", Finish: " << task.getFinishTime() << ")\n";
-    }
 
     return oss.str();
 };
\ No newline at end of file
@@ -24,6 +24,7 @@ static struct option long_options[] = {
     {"config",      required_argument,  0,  'c' },
     {"output",      required_argument,  0,  'o' },
     {"set",         required_argument,  0,  'S' },
+    {"seed",        required_argument,  0,  'r' },
     {"dbg",         no_argument,        0,  'D' },
     {0,             0,                  0,  0   }
 };
@@ -41,11 +42,12 @@ int main(int argc, char **argv) {
     PriorityRefinementMethod refinement_method = PriorityRefinementMethod::NORMAL_PERTURBATION; // Can be set to PSO or normal directly through method selection (e.g., annealing-normal vs annealing-pso)
     bool solve = false;
     std::vector<std::string> cfg_overrides; // Configuration overrides from command line
+    std::string seed; // Random seed from command line (takes precedence over misc.seed)
 
     int opt;
     int option_index = 0;
 
-    while((opt = getopt_long(argc, argv, "vhs:t:n:d:ic:o:S:D", long_options, &option_index)) != -1) {
+    while((opt = getopt_long(argc, argv, "vhs:t:n:d:ic:o:S:r:D", long_options, &option_index)) != -1) {
         switch(opt) {
             case 'v':
                 std::cout << "Solver version 1.0.0" << std::endl;
@@ -66,8 +68,13 @@ int main(int argc, char **argv) {
                     method = SolverMethod::SIMULATED_ANNEALING;
                     refinement_method = PriorityRefinementMethod::PARTICLE_SWARM_OPTIMIZATION;
                 }
+                else if(strcmp(optarg, "annealing-pt") == 0) method = SolverMethod::PARALLEL_TEMPERING;
+                else if(strcmp(optarg, "heft") == 0) method = SolverMethod::HEFT;
+                else if(strcmp(optarg, "tabu") == 0) method = SolverMethod::TABU_SEARCH;
+                else if(strcmp(optarg, "lns") == 0) method = SolverMethod::LARGE_NEIGHBORHOOD_SEARCH;
+                else if(strcmp(optarg, "bnb") == 0) method = SolverMethod::BRANCH_AND_BOUND;
                 else {
-                    utils::printHelp(MANUAL, "Supported methods: random, genetic, annealing");
+                    utils::printHelp(MANUAL, "Supported methods: random, genetic, annealing, annealing-normal, annealing-pso, annealing-pt, heft, tabu, lns, bnb");
                     return 1;
                 }
                 break;
@@ -99,6 +106,9 @@ int main(int argc, char **argv) {
             case 'S':
                 cfg_overrides.emplace_back(optarg);
                 break;
+            case 'r':
+                seed = optarg;
+                break;
             case 'D':
                 utils::dbg.rdbuf(std::cout.rdbuf());
                 break;
@@ -165,6 +175,9 @@ int main(int argc, char **argv) {
             }
             config.solverMethod = method;
             config.sa_priorityRefinementMethod = refinement_method;
+            if(!seed.empty()) {
+                config.seed = std::stoull(seed);
+            }
             utils::dbg << config.print();
             Solver solver(sch, config);
             SolverResult result = solver.solve();
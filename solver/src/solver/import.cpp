@@ -40,6 +40,8 @@ void SolverConfig::fromYaml(const std::string& file_path) {
         if (sa["initial_temperature"])              sa_initialTemperature = sa["initial_temperature"].as<double>();
         if (sa["cooling_rate"])                     sa_coolingRate = sa["cooling_rate"].as<double>();
         if (sa["min_temperature"])                  sa_minTemperature = sa["min_temperature"].as<double>();
+        if (sa["chains"])                           sa_chains = sa["chains"].as<int>();
+        if (sa["restart_gap"])                      sa_restartGap = sa["restart_gap"].as<double>();
         if (sa["refinement_sigma_max"])             sa_sigmaMax = sa["refinement_sigma_max"].as<double>();
         if (sa["refinement_sigma_min"])             sa_sigmaMin = sa["refinement_sigma_min"].as<double>();
         if (sa["refinement_iterations"])            sa_refinementIterations = sa["refinement_iterations"].as<int>();
@@ -50,6 +52,47 @@ void SolverConfig::fromYaml(const std::string& file_path) {
         if (sa["refinement_pso_social_coef"])       sa_pso_socialCoefficient = sa["refinement_pso_social_coef"].as<double>();
     }
 
+    // --- Parallel Tempering ---
+    if (auto pt = root["parallel_tempering"]) {
+        if (pt["replicas"])                  pt_replicas = pt["replicas"].as<int>();
+        if (pt["max_iterations"])            pt_maxIterations = pt["max_iterations"].as<int>();
+        if (pt["timeout"])                   pt_timeout_sec = pt["timeout"].as<int>();
+        if (pt["exchange_interval"])         pt_exchangeInterval = pt["exchange_interval"].as<int>();
+        if (pt["min_temperature"])           pt_minTemperature = pt["min_temperature"].as<double>();
+        if (pt["max_temperature"])           pt_maxTemperature = pt["max_temperature"].as<double>();
+        if (pt["perturbation_rate"])         pt_perturbationRate = pt["perturbation_rate"].as<double>();
+        if (pt["stagnation_limit"])          pt_stagnationLimit = pt["stagnation_limit"].as<int>();
+    }
+
+    // --- Tabu Search ---
+    if (auto ts = root["tabu_search"]) {
+        if (ts["max_iterations"])            ts_maxIterations = ts["max_iterations"].as<int>();
+        if (ts["timeout"])                   ts_timeout_sec = ts["timeout"].as<int>();
+        if (ts["tenure"])                    ts_tenure = ts["tenure"].as<int>();
+        if (ts["neighborhood_size"])         ts_neighborhoodSize = ts["neighborhood_size"].as<int>();
+        if (ts["stagnation_limit"])          ts_stagnationLimit = ts["stagnation_limit"].as<int>();
+    }
+
+    // --- Large Neighborhood Search ---
+    if (auto lns = root["large_neighborhood_search"]) {
+        if (lns["max_iterations"])           lns_maxIterations = lns["max_iterations"].as<int>();
+        if (lns["timeout"])                  lns_timeout_sec = lns["timeout"].as<int>();
+        if (lns["stagnation_limit"])         lns_stagnationLimit = lns["stagnation_limit"].as<int>();
+        if (lns["destroy_fraction"])         lns_destroyFraction = lns["destroy_fraction"].as<double>();
+        if (lns["max_destroy"])              lns_maxDestroy = lns["max_destroy"].as<int>();
+        if (lns["exhaustive_limit"])         lns_exhaustiveLimit = lns["exhaustive_limit"].as<int>();
+        if (lns["segment_length"])           lns_segmentLength = lns["segment_length"].as<int>();
+        if (lns["reaction_factor"])          lns_reactionFactor = lns["reaction_factor"].as<double>();
+        if (lns["acceptance_gap"])           lns_acceptanceGap = lns["acceptance_gap"].as<double>();
+    }
+
+    // --- Branch and Bound ---
+    if (auto bb = root["branch_and_bound"]) {
+        if (bb["timeout"])                   bb_timeout_sec = bb["timeout"].as<int>();
+        if (bb["max_nodes"])                 bb_maxNodes = bb["max_nodes"].as<long long>();
+        if (bb["warm_start"])                bb_warmStart = bb["warm_start"].as<bool>();
+    }
+
     // --- Random Search ---
     if (auto rs = root["random_search"]) {
         if (rs["max_iterations"])            rs_maxIterations = rs["max_iterations"].as<int>();
@@ -71,10 +114,36 @@ void SolverConfig::fromYaml(const std::string& file_path) {
         if (ga["stagnation_limit"])         ga_stagnationLimit = ga["stagnation_limit"].as<int>();
         if (ga["mutation_rate"])            ga_mutationRate = ga["mutation_rate"].as<double>();
         if (ga["crossover_rate"])           ga_crossoverRate = ga["crossover_rate"].as<double>();
+        if (ga["islands"])                  ga_islands = ga["islands"].as<int>();
+        if (ga["migration_interval"])       ga_migrationInterval = ga["migration_interval"].as<int>();
+        if (ga["migration_size"])           ga_migrationSize = ga["migration_size"].as<size_t>();
+        if (auto islandsConfig = ga["islands_config"]) {
+            ga_islandsConfig.clear();
+            for (size_t k = 0; k < islandsConfig.size(); ++k) {
+                ga_islandsConfig.emplace_back();
+                for (const auto& entry : islandsConfig[k]) {
+                    setIslandParameter(k, entry.first.as<std::string>(), entry.second.as<std::string>());
+                }
+            }
+        }
     }
 
     // --- Misc ---
     if (auto misc = root["misc"]) {
+        if (misc["threads"])                threads = misc["threads"].as<int>();
+        if (misc["seed"])                   seed = misc["seed"].as<unsigned long long>();
+        if (misc["heft_init"])              heftInit = misc["heft_init"].as<bool>();
+        if (misc["repair_steps"])           repairSteps = misc["repair_steps"].as<int>();
+        if (misc["staged_rejection"])       stagedRejection = misc["staged_rejection"].as<bool>();
+        if (misc["ready_queue"]) {
+            std::string queue = misc["ready_queue"].as<std::string>();
+            if (queue == "HEAP")
+                readyQueue = ReadyQueueType::BINARY_HEAP;
+            else if (queue == "BUCKET")
+                readyQueue = ReadyQueueType::BUCKET_QUEUE;
+            else
+                utils::throw_runtime_error("Invalid ready_queue in YAML config");
+        }
         if (misc["log_file"]) {
             std::string log_file = misc["log_file"].as<std::string>();
             setLogFile(log_file);
@@ -84,6 +153,22 @@ void SolverConfig::fromYaml(const std::string& file_path) {
     }
 };
 
+void SolverConfig::setIslandParameter(size_t island, const std::string& key, const std::string& val) {
+    // Island entries only override the per-population ga_* parameters; the rest stays global
+    if (island >= ga_islandsConfig.size())
+        ga_islandsConfig.resize(island + 1);
+    GAIslandConfig& cfg = ga_islandsConfig[island];
+
+    if (key == "population_size") cfg.populationSize = std::stoll(val);
+    else if (key == "max_generations") cfg.maxGenerations = std::stoi(val);
+    else if (key == "elite_count") cfg.eliteCount = std::stoll(val);
+    else if (key == "stagnation_threshold") cfg.stagnationThreshold = std::stod(val);
+    else if (key == "stagnation_limit") cfg.stagnationLimit = std::stoi(val);
+    else if (key == "mutation_rate") cfg.mutationRate = std::stod(val);
+    else if (key == "crossover_rate") cfg.crossoverRate = std::stod(val);
+    else utils::throw_runtime_error("Unknown island parameter: " + key);
+}
+
 void SolverConfig::applyOverride(const std::string& override_str) {
     // Parse key=value
     // Overrides are applied after loading from YAML
@@ -118,6 +203,8 @@ void SolverConfig::applyOverride(const std::string& override_str) {
     else if (key == "simulated_annealing.initial_temperature") sa_initialTemperature = std::stod(val);
     else if (key == "simulated_annealing.cooling_rate") sa_coolingRate = std::stod(val);
     else if (key == "simulated_annealing.min_temperature") sa_minTemperature = std::stod(val);
+    else if (key == "simulated_annealing.chains") sa_chains = std::stoi(val);
+    else if (key == "simulated_annealing.restart_gap") sa_restartGap = std::stod(val);
 
     else if (key == "simulated_annealing.refinement_priority_method") {
         if (val == "NORMAL")
@@ -137,6 +224,39 @@ void SolverConfig::applyOverride(const std::string& override_str) {
     else if (key == "simulated_annealing.refinement_pso_cognitive_coef") sa_pso_cognitiveCoefficient = std::stod(val);
     else if (key == "simulated_annealing.refinement_pso_social_coef") sa_pso_socialCoefficient = std::stod(val);
 
+    // ---- PARALLEL TEMPERING ----
+    else if (key == "parallel_tempering.replicas") pt_replicas = std::stoi(val);
+    else if (key == "parallel_tempering.max_iterations") pt_maxIterations = std::stoi(val);
+    else if (key == "parallel_tempering.timeout") pt_timeout_sec = std::stoi(val);
+    else if (key == "parallel_tempering.exchange_interval") pt_exchangeInterval = std::stoi(val);
+    else if (key == "parallel_tempering.min_temperature") pt_minTemperature = std::stod(val);
+    else if (key == "parallel_tempering.max_temperature") pt_maxTemperature = std::stod(val);
+    else if (key == "parallel_tempering.perturbation_rate") pt_perturbationRate = std::stod(val);
+    else if (key == "parallel_tempering.stagnation_limit") pt_stagnationLimit = std::stoi(val);
+
+    // ---- TABU SEARCH ----
+    else if (key == "tabu_search.max_iterations") ts_maxIterations = std::stoi(val);
+    else if (key == "tabu_search.timeout") ts_timeout_sec = std::stoi(val);
+    else if (key == "tabu_search.tenure") ts_tenure = std::stoi(val);
+    else if (key == "tabu_search.neighborhood_size") ts_neighborhoodSize = std::stoi(val);
+    else if (key == "tabu_search.stagnation_limit") ts_stagnationLimit = std::stoi(val);
+
+    // ---- LARGE NEIGHBORHOOD SEARCH ----
+    else if (key == "large_neighborhood_search.max_iterations") lns_maxIterations = std::stoi(val);
+    else if (key == "large_neighborhood_search.timeout") lns_timeout_sec = std::stoi(val);
+    else if (key == "large_neighborhood_search.stagnation_limit") lns_stagnationLimit = std::stoi(val);
+    else if (key == "large_neighborhood_search.destroy_fraction") lns_destroyFraction = std::stod(val);
+    else if (key == "large_neighborhood_search.max_destroy") lns_maxDestroy = std::stoi(val);
+    else if (key == "large_neighborhood_search.exhaustive_limit") lns_exhaustiveLimit = std::stoi(val);
+    else if (key == "large_neighborhood_search.segment_length") lns_segmentLength = std::stoi(val);
+    else if (key == "large_neighborhood_search.reaction_factor") lns_reactionFactor = std::stod(val);
+    else if (key == "large_neighborhood_search.acceptance_gap") lns_acceptanceGap = std::stod(val);
+
+    // ---- BRANCH AND BOUND ----
+    else if (key == "branch_and_bound.timeout") bb_timeout_sec = std::stoi(val);
+    else if (key == "branch_and_bound.max_nodes") bb_maxNodes = std::stoll(val);
+    else if (key == "branch_and_bound.warm_start") bb_warmStart = asBool(val);
+
     // ---- RANDOM SEARCH ----
     else if (key == "random_search.max_iterations") rs_maxIterations = std::stoi(val);
     else if (key == "random_search.timeout") rs_timeout_sec = std::stoi(val);
@@ -155,9 +275,33 @@ void SolverConfig::applyOverride(const std::string& override_str) {
     else if (key == "genetic_algorithm.stagnation_limit") ga_stagnationLimit = std::stoi(val);
     else if (key == "genetic_algorithm.mutation_rate") ga_mutationRate = std::stod(val);
     else if (key == "genetic_algorithm.crossover_rate") ga_crossoverRate = std::stod(val);
+    else if (key == "genetic_algorithm.islands") ga_islands = std::stoi(val);
+    else if (key == "genetic_algorithm.migration_interval") ga_migrationInterval = std::stoi(val);
+    else if (key == "genetic_algorithm.migration_size") ga_migrationSize = std::stoul(val);
+    else if (key.rfind("genetic_algorithm.islands_config.", 0) == 0) {
+        // genetic_algorithm.islands_config.<island>.<parameter>=value
+        const std::string rest = key.substr(std::string("genetic_algorithm.islands_config.").size());
+        const auto dot = rest.find('.');
+        if (dot == std::string::npos)
+            utils::throw_runtime_error("Invalid island override (expected islands_config.<island>.<parameter>): " + key);
+        setIslandParameter(std::stoul(rest.substr(0, dot)), rest.substr(dot + 1), val);
+    }
 
     // ---- MISC ----
     else if (key == "misc.log_file") setLogFile(val);
+    else if (key == "misc.threads") threads = std::stoi(val);
+    else if (key == "misc.seed") seed = std::stoull(val);
+    else if (key == "misc.heft_init") heftInit = asBool(val);
+    else if (key == "misc.repair_steps") repairSteps = std::stoi(val);
+    else if (key == "misc.staged_rejection") stagedRejection = asBool(val);
+    else if (key == "misc.ready_queue") {
+        if (val == "HEAP")
+            readyQueue = ReadyQueueType::BINARY_HEAP;
+        else if (val == "BUCKET")
+            readyQueue = ReadyQueueType::BUCKET_QUEUE;
+        else
+            utils::throw_runtime_error("Invalid ready_queue: " + val);
+    }
 
     else {
         utils::throw_runtime_error("Unknown config key: " + key);
@@ -181,17 +325,17 @@ void SolverConfig::setLogFile(const std::string& file_path) {
     const bool file_exists = std::filesystem::exists(file_path_str);
 
     // Open file in append mode
-    log_file_stream.open(file_path_str, std::ios::app);
-    if (!log_file_stream.is_open())
+    log_file_stream = std::make_shared<std::ofstream>(file_path_str, std::ios::app);
+    if (!log_file_stream->is_open())
         return;
 
     if (!file_exists) { // New file, write header
-        if (log_file_stream.tellp() == 0) { // File is empty, write header
-            log_file_stream << SolverResult::getHeaderCSV();
+        if (log_file_stream->tellp() == 0) { // File is empty, write header
+            *log_file_stream << SolverResult::getHeaderCSV();
         }
     }
 
-    log = &log_file_stream;
+    log = log_file_stream.get();
 
     utils::dbg << "Logging solver output to file: " << file_path_str << "\n";
 } 
\ No newline at end of file
@@ -1,23 +1,44 @@
 #include "solver.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 double Solver::computeObjective() const {
     if (scheduler.getScheduleState() != ScheduleState::SCHEDULED) {
-        utils::dbg << "Schedule not computed yet.\n";
+        utils::threadDbg() << "Schedule not computed yet.\n";
         return -1.0;
     }
-    //int schedule_span = scheduler.getScheduleSpan();
-    int finish_time_sum = scheduler.getFinishTimeSum();
-    int processors_cost = scheduler.getProcessorsCost();
-    int delay_cost = scheduler.getDelayCost();
+    // Components were accumulated by schedule(), no extra pass over the schedule is needed
+    return computeObjective(scheduler.getEvalResult());
+};
 
-    double objective = config.alpha * static_cast<double>(finish_time_sum)
-                     + config.beta * static_cast<double>(delay_cost)
-                     + config.gamma * static_cast<double>(processors_cost);
+double Solver::computeObjective(const EvalResult& result) const {
+    double objective = config.alpha * static_cast<double>(result.finish_time_sum)
+                     + config.beta * static_cast<double>(result.delay_cost)
+                     + config.gamma * static_cast<double>(result.processors_cost);
     return objective;
 };
 
+ObjectiveBound Solver::getObjectiveBound(double threshold) const {
+    // Fitness values are truncated objectives, so fitness < threshold holds exactly when the objective
+    // is below ceil(threshold). Candidates above that can be cut off during scheduling.
+    if (threshold >= static_cast<double>(INT_MAX)) {
+        return ObjectiveBound(); // no incumbent yet
+    }
+    return ObjectiveBound(config.alpha, config.beta, config.gamma, std::ceil(threshold));
+};
+
 SolverResult Solver::solve() {
-    srand(static_cast<unsigned int>(time(nullptr)));
+    const unsigned long long seed = config.seed != 0 ? config.seed : static_cast<unsigned long long>(time(nullptr));
+    utils::dbg << "Random seed: " << seed << "\n";
+    rng.seed(seed);
+    scheduler.setReadyQueue(config.readyQueue);
+    scheduler.setStagedRejection(config.stagedRejection);
+#ifdef _OPENMP
+    if (config.threads > 0) {
+        omp_set_num_threads(config.threads);
+    }
+#endif
     SolverResult result;
 
     switch(config.solverMethod) {
@@ -25,10 +46,25 @@ SolverResult Solver::solve() {
             result = randomSearchSolve();
             break;
         case SolverMethod::GENETIC_ALGORITHM:
-            result =  geneticAlgorithmSolve();
+            result = config.ga_islands > 1 ? islandGeneticAlgorithmSolve() : geneticAlgorithmSolve();
             break;
         case SolverMethod::SIMULATED_ANNEALING:
-            result =  simulatedAnnealingSolve();
+            result = config.sa_chains != 1 ? multiStartAnnealingSolve() : simulatedAnnealingSolve();
+            break;
+        case SolverMethod::PARALLEL_TEMPERING:
+            result = parallelTemperingSolve();
+            break;
+        case SolverMethod::HEFT:
+            result = heftSolve();
+            break;
+        case SolverMethod::TABU_SEARCH:
+            result = tabuSearchSolve();
+            break;
+        case SolverMethod::LARGE_NEIGHBORHOOD_SEARCH:
+            result = largeNeighborhoodSearchSolve();
+            break;
+        case SolverMethod::BRANCH_AND_BOUND:
+            result = branchAndBoundSolve();
             break;
         default:
             utils::dbg << "Unknown solver method.\n";
@@ -0,0 +1,645 @@
+#include "solver.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace {
+
+// Partial schedule of the search: the first `placed` tasks of a list (a topological order), each one on a
+// server, timed as the scheduler would time them. Each thread extends and shortens a single state in place.
+struct BBState {
+    int placed = 0;
+    long long finishSum = 0;
+    long long delayCost = 0;
+    long long processorsCost = 0;
+    std::vector<int> order;
+    std::vector<int> serverOf;
+    std::vector<long long> finish;
+    std::vector<int> pending; // Predecessors not placed yet
+    std::vector<long long> serverReady;
+    std::vector<int> memoryLeft;
+    std::vector<double> utilizationLeft;
+    std::vector<int> serverTaskCount;
+};
+
+// What placing a task changed in the state, to undo it
+struct BBUndo {
+    int task = -1;
+    long long serverReady = 0;
+    double utilizationLeft = 0.0;
+    long long delay = 0;
+};
+
+// Task v on server s as the next entry of the list, with the bound of the list it leads to
+struct BBBranch {
+    int task;
+    int server;
+    double bound;
+};
+
+// Subtree of the parallel search, given by the list leading to it
+struct BBSubtree {
+    std::vector<BBBranch> list;
+    double bound;
+};
+
+class BranchAndBound {
+public:
+    BranchAndBound(const Scheduler& scheduler, const SolverConfig& config, SharedIncumbent& incumbent)
+        : scheduler(scheduler), inst(scheduler.getCompiledInstance()), config(config), incumbent(incumbent) {
+        const int N = inst.task_count;
+        const int S = inst.server_count;
+        for (int s = 0; s < S; ++s) {
+            if (!inst.server_is_mist[s]) allocable.push_back(s);
+        }
+
+        // Static topological order (for the per task bounds) and rank order of the branching
+        std::vector<int> indeg(N);
+        for (int i = 0; i < N; ++i) {
+            indeg[i] = inst.pred_offsets[i + 1] - inst.pred_offsets[i];
+            if (indeg[i] == 0) topo.push_back(i);
+        }
+        for (size_t k = 0; k < topo.size(); ++k) {
+            for (int e = inst.succ_offsets[topo[k]]; e < inst.succ_offsets[topo[k] + 1]; ++e) {
+                if (--indeg[inst.succ_idxs[e]] == 0) topo.push_back(inst.succ_idxs[e]);
+            }
+        }
+        rank.assign(N, 0);
+        for (int k = (int)topo.size() - 1; k >= 0; --k) {
+            const int u = topo[k];
+            for (int e = inst.succ_offsets[u]; e < inst.succ_offsets[u + 1]; ++e) {
+                rank[u] = std::max(rank[u], rank[inst.succ_idxs[e]]);
+            }
+            rank[u] += inst.C[u];
+        }
+        byDuration.resize(N);
+        for (int i = 0; i < N; ++i) byDuration[i] = i;
+        std::sort(byDuration.begin(), byDuration.end(), [&](int x, int y) { return inst.C[x] != inst.C[y] ? inst.C[x] < inst.C[y] : x < y; });
+
+        // Least delay of each precedence towards each server of the successor, over the servers of the
+        // predecessor (a MIST server holds a single task, so both cannot share it)
+        predMinDelay.assign(inst.pred_idxs.size() * S, INT_MAX);
+        for (int t = 0; t < N; ++t) {
+            for (int e = inst.pred_offsets[t]; e < inst.pred_offsets[t + 1]; ++e) {
+                forEachServer(inst.pred_idxs[e], [&](int ps) {
+                    for (int s = 0; s < S; ++s) {
+                        const int d = ps == s ? (inst.server_is_mist[s] ? INT_MAX : 0) : inst.getDelay(ps, s);
+                        predMinDelay[(size_t)e * S + s] = std::min(predMinDelay[(size_t)e * S + s], d);
+                    }
+                });
+            }
+        }
+        fixedOn.resize(S);
+        for (int t = 0; t < N; ++t) {
+            const int fixed = inst.fixed_server[t];
+            if (fixed >= 0 && fixed < S && !inst.server_is_mist[fixed]) fixedOn[fixed].push_back(t);
+        }
+        boundsValid = config.alpha >= 0.0 && config.beta >= 0.0 && config.gamma >= 0.0;
+    }
+
+    bool validGraph() const { return (int)topo.size() == inst.task_count && inst.graph_state == ScheduleState::NOT_SCHEDULED; }
+
+    // Empty list
+    void reset(BBState& state) const {
+        const int N = inst.task_count;
+        const int S = inst.server_count;
+        state.placed = 0;
+        state.finishSum = 0;
+        state.delayCost = 0;
+        state.processorsCost = 0;
+        state.order.assign(N, -1);
+        state.serverOf.assign(N, -1);
+        state.finish.assign(N, 0);
+        state.pending.resize(N);
+        for (int i = 0; i < N; ++i) state.pending[i] = inst.pred_offsets[i + 1] - inst.pred_offsets[i];
+        state.serverReady.assign(S, 0);
+        state.memoryLeft = inst.server_memory;
+        state.utilizationLeft = inst.server_utilization;
+        state.serverTaskCount.assign(S, 0);
+    }
+
+    // State of the list leading to a subtree
+    void replay(BBState& state, const BBSubtree& subtree) const {
+        reset(state);
+        BBUndo undo;
+        for (const BBBranch& branch : subtree.list) placeTask(state, branch.task, branch.server, undo);
+    }
+
+    // Lower bound of the objective of every complete schedule extending the list (infinity if none is feasible):
+    // - Each remaining task starts no earlier than on its best server given the server ready times (tasks
+    //   placed later on a server start after the ones already on it), the placed predecessors, and the
+    //   earliest arrival from the remaining ones (their finish bound on each of their servers plus the
+    //   delay from there). Its delay (at least the least delay of each precedence), cost and finish time
+    //   are bounded on a single server, so their weighted sum is bounded too
+    // - The tasks fixed to a server cannot finish earlier, in total, than by preemptive SRPT on that server
+    //   from its ready time, with their earliest starts as release times
+    // - The movable tasks cannot finish earlier, in total, than by SPT on the servers from their ready times,
+    //   nor than by preemptive SRPT with releases on one machine that runs as fast as the ready servers
+    double lowerBound(const BBState& state) const {
+        if (!boundsValid) {
+            return -std::numeric_limits<double>::infinity();
+        }
+        const double INF = std::numeric_limits<double>::infinity();
+        const int S = inst.server_count;
+        std::vector<long long>& ef = scratchFinish();
+        std::vector<long long>& arrival = scratchArrival();
+        long long delayCost = 0;          // per task bounds
+        long long processorsCost = 0;
+        double combined = 0.0;            // per task bounds of the weighted sum
+        long long fixedMachineSum = 0;    // fixed tasks on MIST servers (single task, no contention)
+        long long movableFinishSum = 0;
+        for (int t : topo) {
+            if (state.serverOf[t] >= 0) {
+                ef[t] = state.finish[t];
+                continue;
+            }
+            long long bestStart = LLONG_MAX;
+            long long bestDelay = LLONG_MAX;
+            int bestCost = INT_MAX;
+            double bestCombined = INF;
+            std::fill(arrival.begin() + (size_t)t * S, arrival.begin() + (size_t)(t + 1) * S, LLONG_MAX);
+            forEachServer(t, [&](int s) {
+                if (inst.server_is_mist[s] && state.serverTaskCount[s] > 0) return;
+                long long start = std::max((long long)inst.a[t], state.serverReady[s]);
+                long long delay = 0;
+                for (int e = inst.pred_offsets[t]; e < inst.pred_offsets[t + 1]; ++e) {
+                    const int p = inst.pred_idxs[e];
+                    const int ps = state.serverOf[p];
+                    const int d = ps >= 0 ? (ps == s ? 0 : inst.getDelay(ps, s)) : predMinDelay[(size_t)e * S + s];
+                    const long long ready = ps >= 0 ? state.finish[p] + d : arrival[(size_t)p * S + s];
+                    if (d == INT_MAX || ready == LLONG_MAX) return;
+                    start = std::max(start, ready);
+                    delay += d;
+                }
+                const long long finish = start + inst.C[t];
+                if (inst.D[t] > 0 && finish > (long long)inst.a[t] + inst.D[t]) return;
+                for (int r = 0; r < S; ++r) {
+                    const int d = r == s ? (inst.server_is_mist[r] ? INT_MAX : 0) : inst.getDelay(s, r);
+                    if (d != INT_MAX) arrival[(size_t)t * S + r] = std::min(arrival[(size_t)t * S + r], finish + d);
+                }
+                bestStart = std::min(bestStart, start);
+                bestDelay = std::min(bestDelay, delay);
+                bestCost = std::min(bestCost, inst.server_cost[s]);
+                bestCombined = std::min(bestCombined, config.alpha * static_cast<double>(finish)
+                                                    + config.beta * static_cast<double>(delay)
+                                                    + config.gamma * static_cast<double>(inst.server_cost[s]));
+            });
+            if (bestStart == LLONG_MAX) {
+                return INF; // no reachable server meets the deadline
+            }
+            ef[t] = bestStart + inst.C[t];
+            delayCost += bestDelay;
+            processorsCost += bestCost;
+            combined += bestCombined;
+            if (inst.fixed_server[t] < 0) {
+                movableFinishSum += ef[t];
+            } else if (fixedOn[inst.fixed_server[t]].empty()) {
+                fixedMachineSum += ef[t];
+            }
+        }
+
+        // Tasks fixed to each server, on that server alone
+        std::vector<long long>& machines = scratchMachines();
+        std::vector<std::pair<long long, int>>& jobs = scratchJobs();
+        double finishBound = static_cast<double>(fixedMachineSum);
+        for (int s : allocable) {
+            jobs.clear();
+            for (int t : fixedOn[s]) {
+                if (state.serverOf[t] < 0) jobs.emplace_back(ef[t] - inst.C[t], inst.C[t]);
+            }
+            machines.assign(1, state.serverReady[s]);
+            finishBound += srptBound(jobs, machines);
+        }
+
+        // Movable tasks on the allocable servers
+        if (!allocable.empty()) {
+            machines.clear();
+            for (int s : allocable) machines.push_back(state.serverReady[s]);
+            std::make_heap(machines.begin(), machines.end(), std::greater<long long>());
+            long long sptSum = 0;
+            jobs.clear();
+            for (int t : byDuration) {
+                if (state.serverOf[t] >= 0 || inst.fixed_server[t] >= 0) continue;
+                std::pop_heap(machines.begin(), machines.end(), std::greater<long long>());
+                machines.back() += inst.C[t];
+                sptSum += machines.back();
+                std::push_heap(machines.begin(), machines.end(), std::greater<long long>());
+                jobs.emplace_back(ef[t] - inst.C[t], inst.C[t]);
+            }
+            machines.clear();
+            for (int s : allocable) machines.push_back(state.serverReady[s]);
+            finishBound += std::max({static_cast<double>(movableFinishSum), static_cast<double>(sptSum), srptBound(jobs, machines)});
+        } else {
+            finishBound += static_cast<double>(movableFinishSum);
+        }
+
+        const double remaining = std::max(combined, config.alpha * finishBound
+                                                  + config.beta * static_cast<double>(delayCost)
+                                                  + config.gamma * static_cast<double>(processorsCost));
+        return config.alpha * static_cast<double>(state.finishSum)
+             + config.beta * static_cast<double>(state.delayCost)
+             + config.gamma * static_cast<double>(state.processorsCost)
+             + remaining;
+    }
+
+    // Branches of a list: each ready task on each of its servers, with a bound below the incumbent, best
+    // bounds first (a branch keeps the bound of its list if that is higher). The bounds are computed by
+    // placing each branch on the state and undoing it.
+    void expand(BBState& state, double bound, std::vector<BBBranch>& branches) const {
+        const int N = inst.task_count;
+        branches.clear();
+        BBUndo undo;
+        for (int v = 0; v < N; ++v) {
+            if (state.serverOf[v] >= 0 || state.pending[v] > 0) continue;
+            forEachServer(v, [&](int s) {
+                if (dominated(state, v, s) || !placeTask(state, v, s, undo)) return;
+                const double branchBound = std::max(bound, lowerBound(state));
+                undoTask(state, undo);
+                if (branchBound < incumbent.getFitness()) branches.push_back(BBBranch{v, s, branchBound});
+            });
+        }
+        std::sort(branches.begin(), branches.end(), [&](const BBBranch& x, const BBBranch& y) {
+            if (x.bound != y.bound) return x.bound < y.bound;
+            if (rank[x.task] != rank[y.task]) return rank[x.task] > rank[y.task];
+            return x.task != y.task ? x.task < y.task : x.server < y.server;
+        });
+    }
+
+    // Depth first search below the list of the state, which is left as it was. Returns false if stopped by
+    // the time or node limits. levels[k] holds the branches of the list of length k on the current path.
+    bool search(BBState& state, double bound, std::vector<std::vector<BBBranch>>& levels, long long& nodes, long long& rejected, const std::chrono::high_resolution_clock::time_point& startTime, int timeoutMs, long long maxNodes, std::atomic<bool>& stop, ScheduleWorkspace& ws) const {
+        if (stop.load(std::memory_order_relaxed)) return false;
+        if ((++nodes & 63) == 0 && (utils::getElapsedMs(startTime) >= timeoutMs || (maxNodes > 0 && nodes >= maxNodes))) {
+            stop.store(true, std::memory_order_relaxed);
+            return false;
+        }
+        if (state.placed == inst.task_count) {
+            if (!offer(state, ws)) rejected++;
+            return true;
+        }
+        std::vector<BBBranch>& branches = levels[state.placed];
+        expand(state, bound, branches);
+        BBUndo undo;
+        for (const BBBranch& branch : branches) {
+            if (branch.bound >= incumbent.getFitness()) break; // sorted by bound, the incumbent may have improved
+            placeTask(state, branch.task, branch.server, undo);
+            const bool completed = search(state, branch.bound, levels, nodes, rejected, startTime, timeoutMs, maxNodes, stop, ws);
+            undoTask(state, undo);
+            if (!completed) return false;
+        }
+        return true;
+    }
+
+    // Candidate reproducing a complete list: priorities decrease along the list, so the scheduler's
+    // topological sort pops the tasks in the same order
+    Candidate toCandidate(const BBState& state) const {
+        const int N = inst.task_count;
+        Candidate candidate(N);
+        for (int k = 0; k < N; ++k) {
+            const int t = state.order[k];
+            candidate.server_indices[t] = state.serverOf[t];
+            candidate.priorities[t] = 1.0 - static_cast<double>(k) / N;
+        }
+        return candidate;
+    }
+
+private:
+    const Scheduler& scheduler;
+    const CompiledInstance& inst;
+    const SolverConfig& config;
+    SharedIncumbent& incumbent;
+    std::vector<int> allocable;
+    std::vector<int> topo;
+    std::vector<int> rank; // Longest computation path to a sink, ready tasks with larger ranks are branched first
+    std::vector<int> byDuration;
+    std::vector<int> predMinDelay; // [e * S + s]: least delay of precedence e (CSR index) when its successor runs on s
+    std::vector<std::vector<int>> fixedOn; // Tasks fixed to each allocable server
+    bool boundsValid;
+
+    std::vector<long long>& scratchFinish() const {
+        static thread_local std::vector<long long> buffer;
+        buffer.resize(inst.task_count);
+        return buffer;
+    }
+    std::vector<long long>& scratchArrival() const {
+        static thread_local std::vector<long long> buffer;
+        buffer.resize((size_t)inst.task_count * inst.server_count);
+        return buffer;
+    }
+    std::vector<long long>& scratchMachines() const {
+        static thread_local std::vector<long long> buffer;
+        return buffer;
+    }
+    std::vector<std::pair<long long, int>>& scratchJobs() const {
+        static thread_local std::vector<std::pair<long long, int>> buffer;
+        return buffer;
+    }
+
+    // Servers a task can be placed on: its fixed server, or its allowed ones
+    template <typename F>
+    void forEachServer(int t, F&& f) const {
+        const int fixed = inst.fixed_server[t];
+        if (fixed >= 0) {
+            if (fixed < inst.server_count) f(fixed);
+            return;
+        }
+        for (int k = 0; k < inst.getAllowedCount(t); ++k) f(inst.getAllowedServer(t, k));
+    }
+
+    // Sum of completion times of preemptive SRPT for jobs (release, duration) on one machine whose speed is
+    // the number of servers ready (machines holds their ready times). No schedule of the jobs on those
+    // servers completes them earlier in total. Sorts both buffers.
+    static double srptBound(std::vector<std::pair<long long, int>>& jobs, std::vector<long long>& machines) {
+        if (jobs.empty()) return 0.0;
+        std::sort(jobs.begin(), jobs.end());
+        std::sort(machines.begin(), machines.end());
+        static thread_local std::vector<double> work; // min heap of the remaining work of the released jobs
+        work.clear();
+        const auto byLeast = std::greater<double>();
+        double time = static_cast<double>(std::min(jobs.front().first, machines.front()));
+        double sum = 0.0;
+        size_t released = 0;
+        size_t ready = 0;
+        while (released < jobs.size() || !work.empty()) {
+            while (released < jobs.size() && static_cast<double>(jobs[released].first) <= time) {
+                work.push_back(static_cast<double>(jobs[released++].second));
+                std::push_heap(work.begin(), work.end(), byLeast);
+            }
+            while (ready < machines.size() && static_cast<double>(machines[ready]) <= time) ready++;
+            double next = std::numeric_limits<double>::infinity(); // next release or server ready time
+            if (released < jobs.size()) next = static_cast<double>(jobs[released].first);
+            if (ready < machines.size()) next = std::min(next, static_cast<double>(machines[ready]));
+            if (work.empty() || ready == 0) {
+                time = next;
+                continue;
+            }
+            const double done = time + work.front() / static_cast<double>(ready);
+            if (done <= next) {
+                sum += done;
+                time = done;
+                std::pop_heap(work.begin(), work.end(), byLeast);
+                work.pop_back();
+            } else {
+                work.front() -= (next - time) * static_cast<double>(ready); // still the least remaining work
+                time = next;
+            }
+        }
+        return sum;
+    }
+
+    bool isPredecessor(int p, int v) const {
+        for (int e = inst.pred_offsets[v]; e < inst.pred_offsets[v + 1]; ++e) {
+            if (inst.pred_idxs[e] == p) return true;
+        }
+        return false;
+    }
+
+    // Dominance: moving a task before placed ones it does not depend on, on other servers, gives the same
+    // schedule. Of the lists that only differ by such moves, only the lexicographically smallest one is
+    // explored, so v is pruned if it could move before a task with a larger index.
+    bool dominated(const BBState& state, int v, int s) const {
+        for (int k = state.placed - 1; k >= 0; --k) {
+            const int w = state.order[k];
+            if (state.serverOf[w] == s || isPredecessor(w, v)) return false;
+            if (w > v) return true;
+        }
+        return false;
+    }
+
+    // Appends task v on server s to the list, with the same timing and checks as the scheduler. Leaves
+    // the state unchanged and returns false if the scheduler would reject it.
+    bool placeTask(BBState& state, int v, int s, BBUndo& undo) const {
+        long long start = std::max((long long)inst.a[v], state.serverReady[s]);
+        long long delay = 0;
+        for (int e = inst.pred_offsets[v]; e < inst.pred_offsets[v + 1]; ++e) {
+            const int p = inst.pred_idxs[e];
+            const int ps = state.serverOf[p];
+            const int d = ps == s ? 0 : inst.getDelay(ps, s);
+            if (d == INT_MAX) return false;
+            start = std::max(start, state.finish[p] + d);
+            delay += d;
+        }
+        const long long finish = start + inst.C[v];
+        if (inst.D[v] > 0 && finish > (long long)inst.a[v] + inst.D[v]) return false;
+        if (inst.server_is_mist[s] && state.serverTaskCount[s] > 0) return false;
+        const double utilizationLeft = state.utilizationLeft[s] - inst.u[v];
+        if (state.memoryLeft[s] - inst.M[v] < 0 || utilizationLeft < 0.0) return false;
+
+        undo.task = v;
+        undo.serverReady = state.serverReady[s];
+        undo.utilizationLeft = state.utilizationLeft[s];
+        undo.delay = delay;
+        if (!inst.server_is_mist[s]) state.serverReady[s] = finish;
+        state.memoryLeft[s] -= inst.M[v];
+        state.utilizationLeft[s] = utilizationLeft;
+        state.serverTaskCount[s]++;
+        state.serverOf[v] = s;
+        state.finish[v] = finish;
+        state.order[state.placed++] = v;
+        state.finishSum += finish;
+        state.delayCost += delay;
+        state.processorsCost += inst.server_cost[s];
+        for (int e = inst.succ_offsets[v]; e < inst.succ_offsets[v + 1]; ++e) {
+            state.pending[inst.succ_idxs[e]]--;
+        }
+        return true;
+    }
+
+    // Removes the last task of the list, placed with undo
+    void undoTask(BBState& state, const BBUndo& undo) const {
+        const int v = undo.task;
+        const int s = state.serverOf[v];
+        for (int e = inst.succ_offsets[v]; e < inst.succ_offsets[v + 1]; ++e) {
+            state.pending[inst.succ_idxs[e]]++;
+        }
+        state.finishSum -= state.finish[v];
+        state.delayCost -= undo.delay;
+        state.processorsCost -= inst.server_cost[s];
+        state.placed--;
+        state.serverOf[v] = -1;
+        state.finish[v] = 0;
+        state.serverTaskCount[s]--;
+        state.utilizationLeft[s] = undo.utilizationLeft;
+        state.memoryLeft[s] += inst.M[v];
+        state.serverReady[s] = undo.serverReady;
+    }
+
+    // Returns false if the scheduler rejects the list (counted by the caller, as this runs in the worker threads)
+    bool offer(const BBState& state, ScheduleWorkspace& ws) const {
+        // The scheduler has the last word on the objective of a complete list
+        const Candidate candidate = toCandidate(state);
+        const EvalResult result = scheduler.evaluate(candidate, ws);
+        if (result.state != ScheduleState::SCHEDULED) {
+            return false;
+        }
+        const double objective = config.alpha * static_cast<double>(result.finish_time_sum)
+                               + config.beta * static_cast<double>(result.delay_cost)
+                               + config.gamma * static_cast<double>(result.processors_cost);
+        incumbent.offer(candidate, static_cast<int>(objective));
+        return true;
+    }
+};
+
+} // namespace
+
+SolverResult Solver::branchAndBoundSolve() {
+    /* Branch and bound
+     * Key aspects:
+        * - Nodes are partial lists of tasks in topological order, each one with its server; a complete list
+        *   is a schedule (priorities decreasing along the list reproduce it), so the search is exact
+        * - Nodes are pruned by a lower bound (per task earliest finish, delay and cost on its best server, SPT
+        *   and preemptive SRPT bounds on the servers ready times and the tasks release times) against the
+        *   incumbent, which starts from HEFT and an LNS warm start of at most a quarter of bb_timeout_sec
+        * - Dominance: of the lists that only differ by moving tasks past independent ones on other servers
+        *   (the same schedule), only the lexicographically smallest one is explored
+        * - The first levels are expanded breadth first, then the subtrees are searched depth first in
+        *   parallel, sharing the incumbent (see SharedIncumbent). Each thread places and undoes the tasks
+        *   of its path on a single state, so nodes are not copied
+        * - Optimality (of the integer fitness) is proven if the search ends before bb_timeout_sec and bb_maxNodes
+    */
+
+    const int timeoutMs         = config.bb_timeout_sec*1000;
+    const long long maxNodes    = config.bb_maxNodes;
+
+    SolverResult results(
+        SolverResult::SolverStatus::NOT_STARTED,
+        scheduler.getInstanceName(),
+        SolverMethod::BRANCH_AND_BOUND,
+        PriorityRefinementMethod::NORMAL_PERTURBATION, // (not used in branch and bound)
+        ScheduleState::NOT_SCHEDULED,
+        Candidate(scheduler.getTaskCount()),
+        config.alpha,
+        config.beta,
+        config.gamma,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        ""
+    );
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    SharedIncumbent sharedIncumbent(scheduler.getTaskCount());
+    BranchAndBound bb(scheduler, config, sharedIncumbent);
+    if (!bb.validGraph()) {
+        results.status = SolverResult::SolverStatus::ERROR;
+        results.observations = "B&B: Invalid task graph.";
+        utils::dbg << results.observations << "\n";
+        return results;
+    }
+
+    // Initial incumbent: the best of the current schedule (if feasible), HEFT and a large neighborhood search
+    // from them, since good incumbents prune far more than the depth first search finds early on
+    if (scheduler.getScheduleState() == ScheduleState::SCHEDULED) {
+        sharedIncumbent.offer(scheduler.getCandidateFromCurrentSchedule(), static_cast<int>(computeObjective()));
+    }
+    const Candidate heft = buildHeftCandidate();
+    if (scheduler.schedule(heft) == ScheduleState::SCHEDULED) {
+        sharedIncumbent.offer(heft, static_cast<int>(computeObjective()));
+    }
+    if (config.bb_warmStart && sharedIncumbent.getFitness() < INT_MAX) {
+        // The warm start runs within the B&B budget
+        const int lnsTimeout = config.lns_timeout_sec;
+        config.lns_timeout_sec = std::min(lnsTimeout, std::max(1, config.bb_timeout_sec / 4));
+        const SolverResult lnsResult = largeNeighborhoodSearchSolve();
+        config.lns_timeout_sec = lnsTimeout;
+        if (lnsResult.scheduleState == ScheduleState::SCHEDULED) {
+            sharedIncumbent.offer(lnsResult.bestCandidate, static_cast<int>(lnsResult.getObjectiveValue()));
+        }
+    }
+    const int initialFitness = sharedIncumbent.getFitness();
+
+#ifdef _OPENMP
+    const int threadCount = omp_get_max_threads();
+#else
+    const int threadCount = 1;
+#endif
+
+    // Breadth first expansion until there are enough subtrees for the threads
+    BBState state;
+    bb.reset(state);
+    const double rootBound = bb.lowerBound(state);
+    std::vector<BBSubtree> frontier(1, BBSubtree{{}, rootBound});
+    std::vector<BBBranch> branches;
+    long long nodes = 1;
+    while (!frontier.empty() && (int)frontier.size() < 8 * threadCount && (int)frontier.front().list.size() < (int)scheduler.getTaskCount()) {
+        std::vector<BBSubtree> next;
+        for (const BBSubtree& subtree : frontier) {
+            if (subtree.bound >= sharedIncumbent.getFitness()) continue;
+            bb.replay(state, subtree);
+            bb.expand(state, subtree.bound, branches);
+            nodes += static_cast<long long>(branches.size());
+            for (const BBBranch& branch : branches) {
+                next.push_back(BBSubtree{subtree.list, branch.bound});
+                next.back().list.push_back(branch);
+            }
+        }
+        frontier = std::move(next);
+    }
+    std::sort(frontier.begin(), frontier.end(), [](const BBSubtree& x, const BBSubtree& y) { return x.bound < y.bound; });
+
+    // Parallel depth first search of the subtrees, each thread on its own state
+    std::atomic<bool> stop{false};
+    std::vector<long long> threadNodes(threadCount, 0);
+    std::vector<long long> threadRejected(threadCount, 0);
+    std::vector<ScheduleWorkspace> workspaces(threadCount);
+    std::vector<BBState> states(threadCount);
+    std::vector<std::vector<std::vector<BBBranch>>> levels(threadCount, std::vector<std::vector<BBBranch>>(scheduler.getTaskCount() + 1));
+    const long long nodesPerThread = maxNodes > 0 ? std::max(1LL, (maxNodes - nodes) / threadCount) : 0;
+    #pragma omp parallel for schedule(dynamic, 1) num_threads(threadCount)
+    for (int k = 0; k < (int)frontier.size(); ++k) {
+#ifdef _OPENMP
+        const int th = omp_get_thread_num();
+#else
+        const int th = 0;
+#endif
+        if (frontier[k].bound >= sharedIncumbent.getFitness()) continue;
+        bb.replay(states[th], frontier[k]);
+        bb.search(states[th], frontier[k].bound, levels[th], threadNodes[th], threadRejected[th], startTime, timeoutMs, nodesPerThread, stop, workspaces[th]);
+    }
+    for (long long n : threadNodes) nodes += n;
+    long long rejected = 0;
+    for (long long n : threadRejected) rejected += n;
+    if (rejected > 0) {
+        utils::dbg << "B&B: " << rejected << " complete lists rejected by the scheduler.\n";
+    }
+
+    const bool proven = !stop.load();
+    results.status = proven ? SolverResult::SolverStatus::COMPLETED : SolverResult::SolverStatus::TIMEOUT;
+    std::ostringstream summary;
+    summary << (proven ? "B&B: Optimal" : "B&B: Stopped before proving optimality") << " after " << nodes << " nodes"
+            << " (root bound " << rootBound << ", initial incumbent " << initialFitness << ").";
+    results.observations = summary.str();
+    utils::dbg << results.observations << "\n";
+
+    if (sharedIncumbent.getFitness() == INT_MAX) {
+        results.status = proven ? SolverResult::SolverStatus::SOLUTION_NOT_FOUND : SolverResult::SolverStatus::TIMEOUT;
+        results.observations = proven ? "B&B: The instance has no feasible schedule." : "B&B: No feasible schedule found before stopping.";
+        utils::dbg << results.observations << "\n";
+        return results;
+    }
+
+    Candidate best(scheduler.getTaskCount());
+    sharedIncumbent.load(best);
+    if (scheduler.schedule(best) != ScheduleState::SCHEDULED) {
+        results.status = SolverResult::SolverStatus::ERROR;
+        results.observations = "B&B: Best candidate infeasible at the end.";
+        utils::dbg << results.observations << "\n";
+        return results;
+    }
+    results.scheduleState = scheduler.getScheduleState();
+    results.bestCandidate = best;
+    results.runtime_ms = utils::getElapsedMs(startTime);
+    results.iterations = static_cast<int>(std::min<long long>(nodes, INT_MAX));
+    results.scheduleSpan = scheduler.getScheduleSpan();
+    results.finishTimeSum = scheduler.getFinishTimeSum();
+    results.processorsCost = scheduler.getProcessorsCost();
+    results.delayCost = scheduler.getDelayCost();
+    results.memoryUsageKB = utils::getPeakMemoryUsageKB();
+
+    return results;
+}
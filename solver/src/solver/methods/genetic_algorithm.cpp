@@ -1,19 +1,12 @@
 #include "solver.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
-struct Individual {
-    Candidate candidate;
-    int fitness;
-    Individual(const Candidate& candidate, int fit) : candidate(candidate), fitness(fit) {}
-};
-
-auto sortByFitness = [](const Individual& a, const Individual& b) {
-    return a.fitness < b.fitness;
-};
-
-Candidate crossover(Scheduler& scheduler, const Candidate& p1, const Candidate& p2) {
+Candidate crossover(const Scheduler& scheduler, const Candidate& p1, const Candidate& p2, utils::Rng& rng) {
     Candidate child = p1;
     for (size_t i = 0; i < scheduler.getTaskCount(); ++i) {
-        if (rand() / (double)RAND_MAX < 0.5) {
+        if (rng() & 1u) {
             child.server_indices[i] = p2.server_indices[i];
         }
         child.priorities[i] =
@@ -22,13 +15,142 @@ Candidate crossover(Scheduler& scheduler, const Candidate& p1, const Candidate&
     return child;
 };
 
+bool Solver::fitterThan(const Individual& a, const Individual& b) {
+    return a.fitness < b.fitness;
+};
+
+bool Solver::initializePopulation(std::vector<Individual>& population, size_t count, SolverResult& results, const std::chrono::high_resolution_clock::time_point& startTime) {
+    // Fills the population with feasible individuals, each one the first feasible sample of an independent
+    // random walk from the current schedule (as a random search with rs_breakOnFirstFeasible would find),
+    // except the first one, which is the HEFT solution when enabled and feasible.
+    // Walks run in parallel, each one with its own stream, so the population only depends on the seed.
+    // Returns false (with the reason in results) if the population cannot be used.
+    const int maxInitTries        = config.ga_maxInitTries;
+    const int timeoutMs           = config.ga_timeout_sec*1000;
+    const double perturbationRate = config.rs_perturbationRate;
+
+    if (scheduler.getNonMISTServerCount() == 0) {
+        results.status = SolverResult::SolverStatus::ERROR;
+        results.observations = "No allocable servers available.";
+        utils::dbg << results.observations << "\n";
+        return false;
+    }
+
+#ifdef _OPENMP
+    const int threadCount = omp_get_max_threads();
+#else
+    const int threadCount = 1;
+#endif
+    const Candidate start = scheduler.getCandidateFromCurrentSchedule();
+    std::vector<utils::Rng> streams = rng.split(count);
+    std::vector<Individual> walks(count);
+    std::vector<ScheduleWorkspace> workspaces(threadCount);
+    std::vector<RepairStats> repairStats(count); // Infeasible samples are repaired, as in the random search
+    std::atomic<bool> timedOut{false};
+
+    // The HEFT solution, if feasible, takes the place of the first walk
+    if (config.heftInit && count > 0) {
+        const Candidate heft = buildHeftCandidate();
+        const EvalResult result = scheduler.evaluate(heft, workspaces[0]);
+        if (result.state == ScheduleState::SCHEDULED) {
+            walks[0] = Individual(heft, static_cast<int>(computeObjective(result)));
+        }
+    }
+
+    #pragma omp parallel for schedule(dynamic) num_threads(threadCount)
+    for (int i = 0; i < static_cast<int>(count); ++i) {
+        if (walks[i].fitness < INT_MAX) {
+            continue; // HEFT individual
+        }
+#ifdef _OPENMP
+        ScheduleWorkspace& ws = workspaces[omp_get_thread_num()];
+#else
+        ScheduleWorkspace& ws = workspaces[0];
+#endif
+        utils::Rng& stream = streams[i];
+        Candidate candidate = start;
+        for (int tr = 0; tr < maxInitTries && !timedOut.load(std::memory_order_relaxed); ++tr) {
+            // Initializaciont timeoutMs check (may take a long time if maxInitTries is large and many infeasible individuals are generated)
+            if (utils::getElapsedMs(startTime) >= timeoutMs) {
+                timedOut.store(true, std::memory_order_relaxed);
+                break;
+            }
+            randomizeCandidate(candidate, perturbationRate, stream);
+            const EvalResult result = repairCandidate(candidate, scheduler.evaluateIncremental(candidate, ws), ws, repairStats[i]);
+            if (result.state == ScheduleState::SCHEDULED) {
+                walks[i] = Individual(candidate, static_cast<int>(computeObjective(result)));
+                break;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        if (walks[i].fitness < INT_MAX) {
+            population.push_back(walks[i]);
+        } else if (!timedOut) {
+            results.status = SolverResult::SolverStatus::ERROR;
+            results.observations = "GA: Individual " + std::to_string(i + 1) + "/" + std::to_string(count) + " infeasible during initialization after " + std::to_string(maxInitTries) + " tries.";
+            utils::dbg << results.observations << "\n";
+            return false;
+        }
+    }
+    if (timedOut) {
+        results.status = SolverResult::SolverStatus::TIMEOUT;
+        results.observations = "GA: Timeout reached after " + std::to_string(timeoutMs) + " seconds.";
+        utils::dbg << results.observations << "\n";
+    }
+
+    // Check if all individuals are feasible
+    if (population.size() < count / 2 || population.empty()) {
+        results.status = SolverResult::SolverStatus::INITIALIZATION_NOT_FEASIBLE;
+        results.observations = "Could not initialize a sufficient feasible population";
+        utils::dbg << results.observations << "\n";
+        return false;
+    }
+
+    // Leave the scheduler with a feasible schedule (the fittest individual), as callers snapshot it
+    scheduler.schedule(std::min_element(population.begin(), population.end(), fitterThan)->candidate);
+    return true;
+};
+
+Solver::Individual Solver::breedChild(const std::vector<Individual>& population, double crossoverRate, double mutationRate, utils::Rng& rng, ScheduleWorkspace& ws, RepairStats& repairStats) const {
+    // Tournament selection, crossover and mutation, drawing only from rng. The child is evaluated with
+    // the const scheduler path, so several threads can breed at once with their own streams and workspaces.
+
+    // Tournament
+    auto tournamentSelect = [&](int k = 3) -> const Individual& {
+        int bestIdx = rng.below(population.size());
+        for (int i = 1; i < k; ++i) {
+            int idx = rng.below(population.size());
+            if (population[idx].fitness < population[bestIdx].fitness)
+                bestIdx = idx;
+        }
+        return population[bestIdx];
+    };
+
+    const auto& p1 = tournamentSelect();
+    const auto& p2 = tournamentSelect();
+
+    Candidate child = p1.candidate;
+
+    if (rng.uniform() < crossoverRate) {
+        child = crossover(scheduler, p1.candidate, p2.candidate, rng);
+    }
+
+    randomizeCandidate(child, mutationRate, rng); // Mutation
+
+    const EvalResult result = repairCandidate(child, scheduler.evaluateIncremental(child, ws), ws, repairStats);
+    if (result.state == ScheduleState::SCHEDULED) {
+        return Individual(child, computeObjective(result));
+    }
+    // If child is infeasible and could not be repaired, keep one of the parents (elitism)
+    return p1;
+};
+
 SolverResult Solver::geneticAlgorithmSolve() {
     
-    const int maxInitTries           = config.ga_maxInitTries;
     const size_t populationSize      = config.ga_populationSize;
     const int maxGenerations         = config.ga_maxGenerations;
-    const double mutationRate        = config.ga_mutationRate;
-    const double crossoverRate       = config.ga_crossoverRate;
     const int timeoutMs              = config.ga_timeout_sec*1000;
     const int stagnationLimit        = config.ga_stagnationLimit;
     const double stagnationThreshold = config.ga_stagnationThreshold;
@@ -58,51 +180,28 @@ SolverResult Solver::geneticAlgorithmSolve() {
 
     // Initialize population
     std::vector<Individual> population;
-    config.rs_breakOnFirstFeasible = true;
-    config.rs_maxIterations = maxInitTries;
-    for (size_t i = 0; i < populationSize; ++i) {
-        SolverResult rsResults = randomSearchSolve();
-        if (scheduler.getScheduleState() == ScheduleState::SCHEDULED) {
-            population.emplace_back(rsResults.bestCandidate, computeObjective());
-        }else{
-            results.status = SolverResult::SolverStatus::ERROR;
-            results.observations = "GA: Individual " + std::to_string(i + 1) + "/" + std::to_string(populationSize) + " infeasible during initialization after " + std::to_string(maxInitTries) + " tries.";
-            utils::dbg << results.observations << "\n";
-            return results;
-        }
-        // Initializaciont timeoutMs check (may take a long time if maxInitTries is large and many infeasible individuals are generated)
-        if(utils::getElapsedMs(startTime) >= timeoutMs) {
-            results.status = SolverResult::SolverStatus::TIMEOUT;
-            results.observations = "GA: Timeout reached after " + std::to_string(timeoutMs) + " seconds.";
-            utils::dbg << results.observations << "\n";
-            break;
-        }
-    }
-
-    // Check if all individuals are feasible
-    if (population.size() < populationSize / 2) {
-        results.status = SolverResult::SolverStatus::INITIALIZATION_NOT_FEASIBLE;
-        results.observations = "Could not initialize a sufficient feasible population";
-        utils::dbg << results.observations << "\n";
+    if (!initializePopulation(population, populationSize, results, startTime)) {
         return results;
     }
 
     // Sort initial population by fitness
-    std::sort(population.begin(), population.end(), sortByFitness);
+    std::sort(population.begin(), population.end(), fitterThan);
     Individual best = population.front();
-    Scheduler bestScheduler = scheduler; // Snapshot when best was last confirmed feasible
-    bool foundFeasible = true; // Population was just initialized with feasible individuals
+    ScheduleSnapshot bestSnapshot; // Schedule of the best individual when it was last confirmed feasible
+    if (scheduler.schedule(best.candidate) == ScheduleState::SCHEDULED) {
+        scheduler.saveSnapshot(best.candidate, bestSnapshot);
+    }
 
-    // Tournament
-    auto tournamentSelect = [&](int k = 3) -> const Individual& {
-        int bestIdx = rand() % population.size();
-        for (int i = 1; i < k; ++i) {
-            int idx = rand() % population.size();
-            if (population[idx].fitness < population[bestIdx].fitness)
-                bestIdx = idx;
-        }
-        return population[bestIdx];
-    };
+    // Offspring are produced in parallel: each worker thread has its own random stream and workspace,
+    // and takes a fixed contiguous range of children, so a run is reproducible for a given seed and thread count
+#ifdef _OPENMP
+    const int threadCount = omp_get_max_threads();
+#else
+    const int threadCount = 1;
+#endif
+    std::vector<utils::Rng> streams = rng.split(threadCount);
+    std::vector<ScheduleWorkspace> workspaces(threadCount);
+    std::vector<RepairStats> repairStats(threadCount);
 
     // GA main loop
     int iterations = 0;
@@ -119,46 +218,38 @@ SolverResult Solver::geneticAlgorithmSolve() {
             break;
         }
 
-        std::vector<Individual> newPopulation;
-
         // Elitism: carry over the best individuals
-        for (size_t i = 0; i < eliteCount && i < population.size(); ++i) {
-            newPopulation.push_back(population[i]);
+        const size_t keptCount = std::min(eliteCount, population.size());
+        std::vector<Individual> newPopulation(std::max(populationSize, keptCount));
+        for (size_t i = 0; i < keptCount; ++i) {
+            newPopulation[i] = population[i];
         }
 
         // Generate new individuals
-        while (newPopulation.size() < populationSize) {
-            const auto& p1 = tournamentSelect();
-            const auto& p2 = tournamentSelect();
-
-            Candidate child = p1.candidate;
-
-            if (rand() / (double)RAND_MAX < crossoverRate) {
-                child = crossover(scheduler, p1.candidate, p2.candidate);
+        const int childCount = static_cast<int>(newPopulation.size() - keptCount);
+        #pragma omp parallel num_threads(threadCount)
+        {
+#ifdef _OPENMP
+            const int t = omp_get_thread_num();
+#else
+            const int t = 0;
+#endif
+            #pragma omp for schedule(static)
+            for (int c = 0; c < childCount; ++c) {
+                newPopulation[keptCount + c] = breedChild(population, config.ga_crossoverRate, config.ga_mutationRate, streams[t], workspaces[t], repairStats[t]);
             }
-
-            randomizeCandidate(child, mutationRate); // Mutation
-
-            if (scheduler.schedule(child) == ScheduleState::SCHEDULED) {
-                int fitness = computeObjective();
-                newPopulation.push_back({child, fitness});
-            } else {
-                // If child is infeasible, keep one of the parents (elitism)
-                newPopulation.push_back(p1);
-            }
-
-            iterations++;
         }
+        iterations += childCount;
 
         population = std::move(newPopulation);
-        std::sort(population.begin(), population.end(), sortByFitness);
+        std::sort(population.begin(), population.end(), fitterThan);
 
         if(population.front().fitness < best.fitness) {
             improvement = best.fitness - population.front().fitness; // compute before updating best
             best = population.front();
             // Save scheduler snapshot when best is updated (re-schedule to capture the state)
             if (scheduler.schedule(best.candidate) == ScheduleState::SCHEDULED) {
-                bestScheduler = scheduler;
+                scheduler.saveSnapshot(best.candidate, bestSnapshot);
             }
             nonImprovingGenerations = 0;
         } else {
@@ -177,10 +268,16 @@ SolverResult Solver::geneticAlgorithmSolve() {
         }
     }
 
+    for (const RepairStats& stats : repairStats) {
+        results.infeasibleCandidates += stats.infeasible;
+        results.repairedCandidates += stats.repaired;
+    }
+
     if (scheduler.schedule(best.candidate) != ScheduleState::SCHEDULED) {
         // Re-scheduling the best candidate failed. If we saved a valid snapshot, restore it.
-        if (foundFeasible) {
-            scheduler = bestScheduler;
+        if (bestSnapshot.result.state == ScheduleState::SCHEDULED) {
+            scheduler.restoreSnapshot(bestSnapshot);
+            best.candidate = bestSnapshot.candidate;
             results.observations = "GA: Best candidate could not be re-scheduled; returning best known state.";
             utils::dbg << results.observations << "\n";
         } else {
@@ -0,0 +1,238 @@
+#include "solver.h"
+#include <atomic>
+#include <thread>
+
+// One-way link of the migration ring (single producer, single consumer, lock-free triple buffer).
+// The producer fills its back buffer and swaps it with the middle one; the consumer swaps its front
+// buffer with the middle one only when a newer batch was published since its last receive.
+// Neither side ever waits: a consumer that finds nothing new simply skips that migration.
+template <typename T>
+struct MigrationLink {
+    static constexpr int FRESH = 4; // Set in middle when it holds a batch the consumer has not taken yet
+
+    std::vector<T> buffers[3];
+    std::atomic<int> middle{1};
+    int back = 0;  // Owned by the producer
+    int front = 2; // Owned by the consumer
+
+    void send(const std::vector<T>& migrants) {
+        buffers[back] = migrants;
+        back = middle.exchange(back | FRESH, std::memory_order_acq_rel) & 3;
+    }
+
+    bool receive(std::vector<T>& migrants) {
+        if (!(middle.load(std::memory_order_relaxed) & FRESH)) return false;
+        front = middle.exchange(front, std::memory_order_acq_rel) & 3;
+        migrants = buffers[front];
+        return true;
+    }
+};
+
+SolverResult Solver::islandGeneticAlgorithmSolve() {
+    /* Island model GA
+     * Key aspects:
+        * - ga_islands populations evolve independently, each one in its own thread with its own random stream
+        * - Every island uses the ga_* parameters of the single population GA (population size, rates, limits),
+        *   except those overridden by its entry in ga_islandsConfig
+        * - Every migrationInterval generations, each island sends copies of its best migrationSize individuals
+        *   to the next island of a ring, where they replace the worst ones
+        * - Migration goes through lock-free single producer/consumer links and never waits: an island takes
+        *   the latest batch published by its neighbour, if any. Runs depend on thread timing as a result
+    */
+
+    const int islandCount            = config.ga_islands;
+    const int timeoutMs              = config.ga_timeout_sec*1000;
+    const int migrationInterval      = std::max(1, config.ga_migrationInterval);
+
+    SolverResult results(
+        SolverResult::SolverStatus::NOT_STARTED,
+        scheduler.getInstanceName(),
+        SolverMethod::GENETIC_ALGORITHM,
+        PriorityRefinementMethod::NORMAL_PERTURBATION, // (not used in GA)
+        ScheduleState::NOT_SCHEDULED,
+        Candidate(scheduler.getTaskCount()),
+        config.alpha,
+        config.beta,
+        config.gamma,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        ""
+    );
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    struct Island {
+        // Parameters, resolved from the global ga_* ones and the island overrides
+        size_t populationSize;
+        int maxGenerations;
+        size_t eliteCount;
+        double stagnationThreshold;
+        int stagnationLimit;
+        double mutationRate;
+        double crossoverRate;
+
+        std::vector<Individual> population;
+        Individual best;
+        utils::Rng rng;
+        ScheduleWorkspace workspace;
+        RepairStats repairStats;
+        int generations = 0;
+        int children = 0;
+        SolverResult::SolverStatus status = SolverResult::SolverStatus::COMPLETED;
+    };
+    std::vector<Island> islands(islandCount);
+    size_t totalPopulation = 0;
+    for (int k = 0; k < islandCount; ++k) {
+        const GAIslandConfig cfg = (size_t)k < config.ga_islandsConfig.size() ? config.ga_islandsConfig[k] : GAIslandConfig();
+        Island& island = islands[k];
+        island.populationSize      = cfg.populationSize > 0 ? (size_t)cfg.populationSize : config.ga_populationSize;
+        island.maxGenerations      = cfg.maxGenerations >= 0 ? cfg.maxGenerations : config.ga_maxGenerations;
+        island.eliteCount          = cfg.eliteCount >= 0 ? (size_t)cfg.eliteCount : config.ga_eliteCount;
+        island.stagnationThreshold = cfg.stagnationThreshold >= 0.0 ? cfg.stagnationThreshold : config.ga_stagnationThreshold;
+        island.stagnationLimit     = cfg.stagnationLimit >= 0 ? cfg.stagnationLimit : config.ga_stagnationLimit;
+        island.mutationRate        = cfg.mutationRate >= 0.0 ? cfg.mutationRate : config.ga_mutationRate;
+        island.crossoverRate       = cfg.crossoverRate >= 0.0 ? cfg.crossoverRate : config.ga_crossoverRate;
+        totalPopulation += island.populationSize;
+    }
+
+    // Initialize all islands at once and deal the individuals round-robin among the islands not yet full
+    std::vector<Individual> initial;
+    if (!initializePopulation(initial, totalPopulation, results, startTime)) {
+        return results;
+    }
+    for (size_t i = 0, k = 0; i < initial.size(); ++k) {
+        Island& island = islands[k % islandCount];
+        if (island.population.size() < island.populationSize) {
+            island.population.push_back(initial[i++]);
+        }
+    }
+    std::vector<utils::Rng> streams = rng.split(islandCount);
+    for (int k = 0; k < islandCount; ++k) {
+        islands[k].rng = streams[k];
+    }
+
+    // links[k] carries migrants from island k to island (k + 1) % islandCount
+    std::vector<MigrationLink<Individual>> links(islandCount);
+
+    auto evolve = [&](int k) {
+        Island& island = islands[k];
+        MigrationLink<Individual>& outbox = links[k];
+        MigrationLink<Individual>& inbox = links[(k + islandCount - 1) % islandCount];
+        std::vector<Individual>& population = island.population;
+        std::vector<Individual> migrants;
+        const size_t migrationSize = std::min(config.ga_migrationSize, island.populationSize);
+
+        std::sort(population.begin(), population.end(), fitterThan);
+        island.best = population.front();
+
+        double improvement = 0.0;
+        int nonImprovingGenerations = 0;
+        for (int generation = 0; generation < island.maxGenerations && !population.empty(); ++generation) {
+
+            // timeoutMs check
+            if (utils::getElapsedMs(startTime) >= timeoutMs) {
+                island.status = SolverResult::SolverStatus::TIMEOUT;
+                break;
+            }
+
+            // Elitism and offspring, as in the single population GA
+            const size_t keptCount = std::min(island.eliteCount, population.size());
+            std::vector<Individual> newPopulation(population.begin(), population.begin() + keptCount);
+            while (newPopulation.size() < island.populationSize) {
+                newPopulation.push_back(breedChild(population, island.crossoverRate, island.mutationRate, island.rng, island.workspace, island.repairStats));
+                island.children++;
+            }
+            population = std::move(newPopulation);
+            std::sort(population.begin(), population.end(), fitterThan);
+
+            // Migration: send the best individuals and replace the worst ones with the incoming migrants
+            if ((generation + 1) % migrationInterval == 0) {
+                outbox.send(std::vector<Individual>(population.begin(), population.begin() + std::min(migrationSize, population.size())));
+                if (inbox.receive(migrants)) {
+                    for (size_t m = 0; m < migrants.size() && m < population.size(); ++m) {
+                        population[population.size() - 1 - m] = migrants[m];
+                    }
+                    std::sort(population.begin(), population.end(), fitterThan);
+                }
+            }
+            island.generations = generation + 1;
+
+            if (population.front().fitness < island.best.fitness) {
+                improvement = island.best.fitness - population.front().fitness; // compute before updating best
+                island.best = population.front();
+                nonImprovingGenerations = 0;
+            } else {
+                improvement = 0.0;
+            }
+
+            // Stagnation check
+            if (improvement < island.stagnationThreshold) {
+                nonImprovingGenerations++;
+                if (nonImprovingGenerations >= island.stagnationLimit) {
+                    island.status = SolverResult::SolverStatus::STAGNATION;
+                    break;
+                }
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (int k = 0; k < islandCount; ++k) {
+        workers.emplace_back(evolve, k);
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    // Merge: best individual over all islands, timeout if any island timed out, stagnation if all stagnated
+    int bestIsland = 0;
+    int iterations = 0;
+    int stagnated = 0;
+    results.status = SolverResult::SolverStatus::COMPLETED;
+    std::ostringstream islandSummary;
+    for (int k = 0; k < islandCount; ++k) {
+        const Island& island = islands[k];
+        if (island.best.fitness < islands[bestIsland].best.fitness) {
+            bestIsland = k;
+        }
+        iterations += island.children;
+        results.infeasibleCandidates += island.repairStats.infeasible;
+        results.repairedCandidates += island.repairStats.repaired;
+        if (island.status == SolverResult::SolverStatus::TIMEOUT) {
+            results.status = SolverResult::SolverStatus::TIMEOUT;
+        }
+        if (island.status == SolverResult::SolverStatus::STAGNATION) {
+            stagnated++;
+        }
+        islandSummary << " [" << k << ": " << island.generations << " gen, best " << island.best.fitness << "]";
+    }
+    if (stagnated == islandCount) {
+        results.status = SolverResult::SolverStatus::STAGNATION;
+    }
+    results.observations = "GA islands:" + islandSummary.str();
+    utils::dbg << results.observations << "\n";
+
+    const Individual& best = islands[bestIsland].best;
+    if (scheduler.schedule(best.candidate) != ScheduleState::SCHEDULED) {
+        results.status = SolverResult::SolverStatus::ERROR;
+        results.observations = "GA: Best candidate infeasible at the end.";
+        utils::dbg << results.observations << "\n";
+        return results;
+    }
+    results.scheduleState = scheduler.getScheduleState();
+    results.bestCandidate = best.candidate;
+    results.runtime_ms = utils::getElapsedMs(startTime);
+    results.iterations = iterations;
+    results.scheduleSpan = scheduler.getScheduleSpan();
+    results.finishTimeSum = scheduler.getFinishTimeSum();
+    results.processorsCost = scheduler.getProcessorsCost();
+    results.delayCost = scheduler.getDelayCost();
+    results.memoryUsageKB = utils::getPeakMemoryUsageKB();
+
+    return results;
+}
@@ -0,0 +1,225 @@
+#include "solver.h"
+
+Candidate Solver::buildHeftCandidate() const {
+    /* HEFT-style list scheduling
+     * Key aspects:
+        * - Upward rank of each task: C plus the largest (average delay + rank) over its successors,
+        *   so tasks on long chains to the end of the graph come first
+        * - Priorities are the normalized ranks, and tasks are placed in the order the scheduler will
+        *   use for them (Kahn's algorithm with the same tie-breaking)
+        * - Each task goes to the non-MIST server with the earliest finish time among those with memory
+        *   and utilization left, preferring servers that meet the deadline; ties are broken by the
+        *   delay and processors cost weighted as in the objective. Fixed tasks keep their server
+        * - O(S^2) once for the average delay, then O(N log N + S * (N + E))
+        * - Deterministic, no random numbers are drawn
+    */
+    const CompiledInstance& inst = scheduler.getCompiledInstance();
+    const int N = inst.task_count;
+    const int S = inst.server_count;
+    Candidate candidate(N);
+    if (N == 0 || inst.graph_state != ScheduleState::NOT_SCHEDULED) {
+        return candidate;
+    }
+
+    // Average delay of a transfer to an allocable server (delays between different servers only)
+    double delaySum = 0.0;
+    long long delayCount = 0;
+    for (int from = 0; from < S; ++from) {
+        for (int to = 0; to < S; ++to) {
+            const int delay = inst.getDelay(from, to);
+            if (from != to && !inst.server_is_mist[to] && delay != INT_MAX) {
+                delaySum += delay;
+                delayCount++;
+            }
+        }
+    }
+    const double averageDelay = delayCount > 0 ? delaySum / static_cast<double>(delayCount) : 0.0;
+
+    // Upward ranks, computed in reverse topological order
+    std::vector<int> pending(N);
+    std::vector<int> order;
+    order.reserve(N);
+    for (int i = 0; i < N; ++i) {
+        pending[i] = inst.pred_offsets[i + 1] - inst.pred_offsets[i];
+        if (pending[i] == 0) order.push_back(i);
+    }
+    for (size_t k = 0; k < order.size(); ++k) {
+        const int u = order[k];
+        for (int e = inst.succ_offsets[u]; e < inst.succ_offsets[u + 1]; ++e) {
+            if (--pending[inst.succ_idxs[e]] == 0) order.push_back(inst.succ_idxs[e]);
+        }
+    }
+    if ((int)order.size() != N) {
+        return candidate; // cycle, the scheduler rejects the graph anyway
+    }
+    std::vector<double> rank(N, 0.0);
+    double maxRank = 0.0;
+    for (int k = N - 1; k >= 0; --k) {
+        const int u = order[k];
+        double successorRank = 0.0;
+        for (int e = inst.succ_offsets[u]; e < inst.succ_offsets[u + 1]; ++e) {
+            successorRank = std::max(successorRank, averageDelay + rank[inst.succ_idxs[e]]);
+        }
+        rank[u] = inst.C[u] + successorRank;
+        maxRank = std::max(maxRank, rank[u]);
+    }
+    for (int i = 0; i < N; ++i) {
+        candidate.priorities[i] = maxRank > 0.0 ? rank[i] / maxRank : 1.0;
+    }
+
+    // Place the tasks in the order the scheduler will use for these priorities
+    std::vector<long long> serverReady(S, 0);
+    std::vector<int> memoryLeft(inst.server_memory);
+    std::vector<double> utilizationLeft(inst.server_utilization);
+    std::vector<long long> finish(N, 0);
+    std::vector<int> serverOf(N, -1);
+    std::vector<PQItem> heap;
+    const PQItemCmp cmp;
+    for (int i = 0; i < N; ++i) {
+        pending[i] = inst.pred_offsets[i + 1] - inst.pred_offsets[i];
+        if (pending[i] == 0) {
+            heap.push_back(PQItem{ candidate.priorities[i], i });
+            std::push_heap(heap.begin(), heap.end(), cmp);
+        }
+    }
+
+    while (!heap.empty()) {
+        std::pop_heap(heap.begin(), heap.end(), cmp);
+        const int u = heap.back().idx;
+        heap.pop_back();
+
+        // Earliest finish of u on server s, with the delay it adds (-1 if a predecessor cannot reach s)
+        auto finishOn = [&](int s, long long& addedDelay) -> long long {
+            long long ready = std::max((long long)inst.a[u], serverReady[s]);
+            addedDelay = 0;
+            for (int e = inst.pred_offsets[u]; e < inst.pred_offsets[u + 1]; ++e) {
+                const int p = inst.pred_idxs[e];
+                if (serverOf[p] == s) {
+                    ready = std::max(ready, finish[p]);
+                    continue;
+                }
+                const int delay = inst.getDelay(serverOf[p], s);
+                if (delay == INT_MAX) return -1;
+                ready = std::max(ready, finish[p] + delay);
+                addedDelay += delay;
+            }
+            return ready + inst.C[u];
+        };
+
+        int chosen = inst.fixed_server[u];
+        long long chosenFinish = 0;
+        long long addedDelay = 0;
+        if (chosen >= 0) {
+            chosenFinish = std::max(finishOn(chosen, addedDelay), 0LL);
+        } else {
+            // Candidates are compared by (misses deadline, finish time, weighted delay and cost), first
+            // among servers with resources left, then among all of them if none has
+            const long long latestFinish = inst.D[u] > 0 ? (long long)inst.a[u] + inst.D[u] : LLONG_MAX;
+            bool chosenMisses = true;
+            double chosenCost = 0.0;
+            for (int pass = 0; pass < 2 && chosen < 0; ++pass) {
+                for (int k = 0; k < inst.getAllowedCount(u); ++k) {
+                    const int s = inst.getAllowedServer(u, k);
+                    if (pass == 0 && (memoryLeft[s] - inst.M[u] < 0 || utilizationLeft[s] - inst.u[u] < 0.0)) continue;
+                    const long long f = finishOn(s, addedDelay);
+                    if (f < 0) continue;
+                    const bool misses = f > latestFinish;
+                    const double cost = config.beta * static_cast<double>(addedDelay) + config.gamma * static_cast<double>(inst.server_cost[s]);
+                    if (chosen < 0 || misses < chosenMisses || (misses == chosenMisses && (f < chosenFinish || (f == chosenFinish && cost < chosenCost)))) {
+                        chosen = s;
+                        chosenFinish = f;
+                        chosenMisses = misses;
+                        chosenCost = cost;
+                    }
+                }
+            }
+            if (chosen < 0) {
+                return candidate; // no server can host u, leave it unassigned
+            }
+        }
+
+        candidate.server_indices[u] = chosen;
+        serverOf[u] = chosen;
+        finish[u] = chosenFinish;
+        if (!inst.server_is_mist[chosen]) {
+            serverReady[chosen] = chosenFinish;
+        }
+        memoryLeft[chosen] -= inst.M[u];
+        utilizationLeft[chosen] -= inst.u[u];
+
+        for (int e = inst.succ_offsets[u]; e < inst.succ_offsets[u + 1]; ++e) {
+            const int v = inst.succ_idxs[e];
+            if (--pending[v] == 0) {
+                heap.push_back(PQItem{ candidate.priorities[v], v });
+                std::push_heap(heap.begin(), heap.end(), cmp);
+            }
+        }
+    }
+
+    return candidate;
+}
+
+bool Solver::findInitialSolution(Candidate& initial, int maxInitTries) {
+    // Initial solution of the local search methods: the current schedule if it is feasible (e.g., imported),
+    // else the HEFT candidate if it is feasible, else the first feasible one of a random search
+    if (config.heftInit && scheduler.getScheduleState() != ScheduleState::SCHEDULED) {
+        Candidate heft = buildHeftCandidate();
+        if (scheduler.schedule(heft) == ScheduleState::SCHEDULED) {
+            utils::threadDbg() << "Initial solution from HEFT.\n";
+            initial = heft;
+            return true;
+        }
+        utils::threadDbg() << "HEFT solution infeasible (" << scheduler.getScheduleState().toString() << "), using random search.\n";
+    }
+    config.rs_breakOnFirstFeasible = true;
+    config.rs_maxIterations = maxInitTries;
+    SolverResult rsResult = randomSearchSolve();
+    initial = rsResult.bestCandidate;
+    return scheduler.getScheduleState() == ScheduleState::SCHEDULED;
+}
+
+SolverResult Solver::heftSolve() {
+    // Constructive HEFT solution, see buildHeftCandidate()
+
+    SolverResult results(
+        SolverResult::SolverStatus::NOT_STARTED,
+        scheduler.getInstanceName(),
+        SolverMethod::HEFT,
+        PriorityRefinementMethod::NORMAL_PERTURBATION, // (not used in HEFT)
+        ScheduleState::NOT_SCHEDULED,
+        Candidate(scheduler.getTaskCount()),
+        config.alpha,
+        config.beta,
+        config.gamma,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        ""
+    );
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    const Candidate candidate = buildHeftCandidate();
+    results.iterations = 1;
+    results.scheduleState = scheduler.schedule(candidate);
+    if (results.scheduleState != ScheduleState::SCHEDULED) {
+        results.status = SolverResult::SolverStatus::SOLUTION_NOT_FOUND;
+        results.observations = "HEFT: Constructed schedule is not feasible (" + results.scheduleState.toString() + ").";
+        utils::threadDbg() << results.observations << "\n";
+        return results;
+    }
+    results.status = SolverResult::SolverStatus::COMPLETED;
+    results.bestCandidate = candidate;
+    results.runtime_ms = utils::getElapsedMs(startTime);
+    results.scheduleSpan = scheduler.getScheduleSpan();
+    results.finishTimeSum = scheduler.getFinishTimeSum();
+    results.processorsCost = scheduler.getProcessorsCost();
+    results.delayCost = scheduler.getDelayCost();
+    results.memoryUsageKB = utils::getPeakMemoryUsageKB();
+
+    return results;
+}
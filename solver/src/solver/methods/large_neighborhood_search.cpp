@@ -0,0 +1,371 @@
+#include "solver.h"
+
+namespace {
+
+enum DestroyOperator { DESTROY_SUBTREE, DESTROY_SERVER, DESTROY_TIME_WINDOW, DESTROY_COUNT };
+enum RepairOperator { REPAIR_GREEDY, REPAIR_GREEDY_PRIORITIES, REPAIR_EXHAUSTIVE, REPAIR_COUNT };
+
+const char* const DESTROY_NAMES[DESTROY_COUNT] = { "subtree", "server", "time window" };
+const char* const REPAIR_NAMES[REPAIR_COUNT] = { "greedy", "greedy priorities", "exhaustive" };
+
+// Adaptive weights of a set of operators (Ropke and Pisinger): operators are drawn with probability
+// proportional to their weight, and at the end of each segment the weights move towards the mean score
+// the operators obtained in it.
+struct OperatorWeights {
+    std::vector<double> weight;
+    std::vector<double> score;
+    std::vector<int> uses;
+    std::vector<int> totalUses;
+
+    explicit OperatorWeights(int count) : weight(count, 1.0), score(count, 0.0), uses(count, 0), totalUses(count, 0) {}
+
+    int draw(utils::Rng& rng) const {
+        double total = 0.0;
+        for (double w : weight) total += w;
+        double r = rng.uniform() * total;
+        for (size_t k = 0; k + 1 < weight.size(); ++k) {
+            if (r < weight[k]) return static_cast<int>(k);
+            r -= weight[k];
+        }
+        return static_cast<int>(weight.size()) - 1;
+    }
+
+    void reward(int k, double points) {
+        score[k] += points;
+        uses[k]++;
+        totalUses[k]++;
+    }
+
+    void update(double reaction) {
+        for (size_t k = 0; k < weight.size(); ++k) {
+            if (uses[k] > 0) {
+                weight[k] = std::max(1e-3, (1.0 - reaction) * weight[k] + reaction * score[k] / uses[k]);
+            }
+            score[k] = 0.0;
+            uses[k] = 0;
+        }
+    }
+};
+
+} // namespace
+
+SolverResult Solver::largeNeighborhoodSearchSolve() {
+    /* Adaptive large neighborhood search (destroy and repair)
+     * Key aspects:
+        * - Each iteration removes a structured subset of tasks from the current solution: a subtree of the
+        *   DAG, the tasks of one server, or the tasks starting in a time window of the current schedule.
+        *   Removed tasks are parked with priorities below all the others, so they are scheduled after every
+        *   task that does not depend on them (successors that stay still wait for them)
+        * - The removed tasks are re-inserted one by one, in their previous topological order, on the server
+        *   that gives the best objective (greedy), optionally with new random priorities, or by enumerating
+        *   every allocation of the first ones (exhaustive, up to lns_exhaustiveLimit combinations) and
+        *   inserting the rest greedily. While some tasks are still parked, trials are ranked by the objective
+        *   of the schedule before the first parked task, as the parked ones often miss their deadlines
+        * - The server trials of a task only change that task, so the incremental evaluation restarts at its
+        *   position and the part of the schedule before it is not recomputed
+        * - Operators are drawn with adaptive weights (ALNS), rewarded when they find a new best, an
+        *   improvement or an accepted solution
+        * - A new solution is accepted if it is better than the current one or within lns_acceptanceGap of the best
+    */
+
+    const int maxIterations         = config.lns_maxIterations;
+    const int timeoutMs             = config.lns_timeout_sec*1000;
+    const int stagnationLimit       = config.lns_stagnationLimit;
+    const double destroyFraction    = config.lns_destroyFraction;
+    const int maxDestroy            = config.lns_maxDestroy;
+    const int exhaustiveLimit       = config.lns_exhaustiveLimit;
+    const int segmentLength         = std::max(1, config.lns_segmentLength);
+    const double reactionFactor     = config.lns_reactionFactor;
+    const double acceptanceGap      = config.lns_acceptanceGap;
+
+    // Scores of the adaptive weights
+    const double SCORE_BEST = 33.0;
+    const double SCORE_IMPROVED = 9.0;
+    const double SCORE_ACCEPTED = 13.0;
+
+    SolverResult results(
+        SolverResult::SolverStatus::NOT_STARTED,
+        scheduler.getInstanceName(),
+        SolverMethod::LARGE_NEIGHBORHOOD_SEARCH,
+        PriorityRefinementMethod::NORMAL_PERTURBATION, // (not used in LNS)
+        ScheduleState::NOT_SCHEDULED,
+        Candidate(scheduler.getTaskCount()),
+        config.alpha,
+        config.beta,
+        config.gamma,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        ""
+    );
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    // Initialize with HEFT or random search to find an initial feasible solution
+    Candidate curr(scheduler.getTaskCount());
+    if (!findInitialSolution(curr, config.sa_maxInitTries)) {
+        results.status = SolverResult::SolverStatus::INITIALIZATION_NOT_FEASIBLE;
+        results.observations = "LNS: Could not find initial feasible solution";
+        utils::dbg << results.observations << "\n";
+        return results;
+    }
+
+    const CompiledInstance& inst = scheduler.getCompiledInstance();
+    const int N = inst.task_count;
+    const double INF = std::numeric_limits<double>::infinity();
+    const int destroyLimit = std::max(1, std::min(maxDestroy, static_cast<int>(destroyFraction * N)));
+
+    ScheduleWorkspace ws;
+    int currFitness = static_cast<int>(computeObjective(scheduler.evaluate(curr, ws)));
+    std::vector<int> currStart = ws.start_times;
+    std::vector<int> currTopoPos = ws.topo_pos;
+    Candidate best = curr;
+    int bestFitness = currFitness;
+
+    OperatorWeights destroyWeights(DESTROY_COUNT);
+    OperatorWeights repairWeights(REPAIR_COUNT);
+
+    std::vector<int> removed;
+    std::vector<char> isRemoved(N, 0);
+    std::vector<int> byStart(N);
+    std::vector<int> stack;
+    std::vector<int> movable;
+    std::vector<double> insertPriority(N);
+    std::vector<int> digits;
+    std::vector<int> chosen;
+    Candidate next = curr;
+    int nonImprovingIterations = 0;
+    int iteration;
+    results.status = SolverResult::SolverStatus::COMPLETED; // Default to completed unless timeoutMs or stagnation occurs
+
+    for (iteration = 0; iteration < maxIterations; ++iteration) {
+
+        // timeoutMs check
+        if (utils::getElapsedMs(startTime) >= timeoutMs) {
+            results.status = SolverResult::SolverStatus::TIMEOUT;
+            results.observations = "LNS: Timeout reached after " + std::to_string(timeoutMs) + " seconds.";
+            utils::dbg << results.observations << "\n";
+            break;
+        }
+
+        // Destroy: choose the tasks to re-insert
+        const int destroyOp = destroyWeights.draw(rng);
+        const int repairOp = repairWeights.draw(rng);
+        const int target = destroyLimit / 2 + 1 + static_cast<int>(rng.below(destroyLimit - destroyLimit / 2));
+        removed.clear();
+        std::fill(isRemoved.begin(), isRemoved.end(), 0);
+        auto remove = [&](int t) {
+            if (!isRemoved[t]) {
+                isRemoved[t] = 1;
+                removed.push_back(t);
+            }
+        };
+        switch (destroyOp) {
+            case DESTROY_SUBTREE: {
+                // A random task and its descendants, depth first
+                stack.assign(1, static_cast<int>(rng.below(N)));
+                while (!stack.empty() && (int)removed.size() < target) {
+                    const int u = stack.back();
+                    stack.pop_back();
+                    if (isRemoved[u]) continue;
+                    remove(u);
+                    for (int e = inst.succ_offsets[u]; e < inst.succ_offsets[u + 1]; ++e) {
+                        stack.push_back(inst.succ_idxs[e]);
+                    }
+                }
+                break;
+            }
+            case DESTROY_SERVER: {
+                // Movable tasks of the server hosting a random task
+                const int pivot = static_cast<int>(rng.below(N));
+                const int server = inst.fixed_server[pivot] >= 0 ? inst.fixed_server[pivot] : curr.server_indices[pivot];
+                const int first = static_cast<int>(rng.below(N)); // so large servers do not always lose the same tasks
+                for (int k = 0; k < N && (int)removed.size() < target; ++k) {
+                    const int t = (first + k) % N;
+                    if (inst.fixed_server[t] < 0 && curr.server_indices[t] == server) remove(t);
+                }
+                break;
+            }
+            case DESTROY_TIME_WINDOW:
+            default: {
+                // Tasks with consecutive start times in the current schedule
+                for (int t = 0; t < N; ++t) byStart[t] = t;
+                std::sort(byStart.begin(), byStart.end(), [&](int x, int y) {
+                    return currStart[x] != currStart[y] ? currStart[x] < currStart[y] : x < y;
+                });
+                const int first = static_cast<int>(rng.below(std::max(1, N - target + 1)));
+                for (int k = first; k < N && (int)removed.size() < target; ++k) {
+                    remove(byStart[k]);
+                }
+                break;
+            }
+        }
+
+        // Destroy: park the removed tasks below every other priority, so they are scheduled after the tasks
+        // that do not depend on them and do not hold their servers while those are placed. The priority they
+        // are re-inserted with is kept in insertPriority (the current one, or a new random one)
+        std::sort(removed.begin(), removed.end(), [&](int x, int y) { return currTopoPos[x] < currTopoPos[y]; });
+        next = curr;
+        const auto priorityRange = std::minmax_element(curr.priorities.begin(), curr.priorities.end());
+        const double parkOffset = *priorityRange.second - *priorityRange.first + 1.0;
+        movable.clear();
+        for (int t : removed) {
+            insertPriority[t] = repairOp == REPAIR_GREEDY_PRIORITIES ? rng.uniform() : curr.priorities[t];
+            next.priorities[t] = insertPriority[t] - parkOffset;
+            if (inst.fixed_server[t] < 0) movable.push_back(t);
+        }
+
+        // Score of a trial insertion while removed[parkedFrom..] are still parked: objective of the schedule
+        // before the first parked task (infinity if it is infeasible), so the parked tasks, which are timed
+        // last and often miss their deadlines, do not make every trial infeasible. With no parked task left
+        // it is the objective of the whole schedule, and the trial is bounded by the best one so far.
+        auto trialScore = [&](size_t parkedFrom, double bestScore) -> double {
+            if (parkedFrom == removed.size()) {
+                const EvalResult result = scheduler.evaluateIncremental(next, ws, getObjectiveBound(bestScore));
+                return result.state == ScheduleState::SCHEDULED ? computeObjective(result) : INF;
+            }
+            const EvalResult result = scheduler.evaluateIncremental(next, ws);
+            int firstParked = N;
+            for (size_t k = parkedFrom; k < removed.size(); ++k) {
+                firstParked = std::min(firstParked, ws.topo_pos[removed[k]]);
+            }
+            if (result.state != ScheduleState::SCHEDULED) {
+                const int failedAt = ws.overflow_pos >= 0 ? ws.overflow_pos : ws.placed_count;
+                if (failedAt < firstParked) return INF;
+            }
+            if (firstParked == 0) return 0.0;
+            EvalResult prefix(ScheduleState::SCHEDULED);
+            prefix.finish_time_sum = static_cast<int>(ws.prefix_finish_sum[firstParked - 1]);
+            prefix.delay_cost = static_cast<int>(ws.prefix_delay_cost[firstParked - 1]);
+            prefix.processors_cost = static_cast<int>(ws.prefix_processors_cost[firstParked - 1]);
+            return computeObjective(prefix);
+        };
+
+        // Repair: re-insert the removed tasks in the order they had in the current schedule
+        size_t restored = 0; // removed[0, restored) already have their insertion priority
+        size_t m = 0;
+        long long combinations = 1;
+        if (repairOp == REPAIR_EXHAUSTIVE) {
+            while (m < movable.size() && combinations * inst.getAllowedCount(movable[m]) <= exhaustiveLimit) {
+                combinations *= inst.getAllowedCount(movable[m]);
+                ++m;
+            }
+        }
+        if (combinations > 1) {
+            // Every allocation of the first m movable tasks to their allowed servers, with at most exhaustiveLimit combinations
+            while (restored < removed.size() && currTopoPos[removed[restored]] <= currTopoPos[movable[m - 1]]) {
+                next.priorities[removed[restored]] = insertPriority[removed[restored]];
+                ++restored;
+            }
+            digits.assign(m, 0);
+            chosen.resize(m);
+            for (size_t k = 0; k < m; ++k) chosen[k] = next.server_indices[movable[k]];
+            double bestTrial = INF;
+            for (long long c = 0; c < combinations; ++c) {
+                for (size_t k = 0; k < m; ++k) {
+                    next.server_indices[movable[k]] = inst.getAllowedServer(movable[k], digits[k]);
+                }
+                const double score = trialScore(restored, bestTrial);
+                if (score < bestTrial) {
+                    bestTrial = score;
+                    for (size_t k = 0; k < m; ++k) chosen[k] = next.server_indices[movable[k]];
+                }
+                // Next combination, the last tasks change fastest so trials share the longest prefix
+                for (int k = static_cast<int>(m) - 1; k >= 0; --k) {
+                    if (++digits[k] < inst.getAllowedCount(movable[k])) break;
+                    digits[k] = 0;
+                }
+            }
+            for (size_t k = 0; k < m; ++k) next.server_indices[movable[k]] = chosen[k];
+        }
+        for (; restored < removed.size(); ++restored) {
+            // Unpark the task and move it to its best server, the tasks still parked keep their current servers
+            const int t = removed[restored];
+            next.priorities[t] = insertPriority[t];
+            if (inst.getAllowedCount(t) <= 1) continue; // Fixed task, or a single allowed server
+            double bestTrial = INF;
+            int bestServer = next.server_indices[t];
+            for (int s = 0; s < inst.getAllowedCount(t); ++s) {
+                next.server_indices[t] = inst.getAllowedServer(t, s);
+                const double score = trialScore(restored + 1, bestTrial);
+                if (score < bestTrial) {
+                    bestTrial = score;
+                    bestServer = next.server_indices[t];
+                }
+            }
+            next.server_indices[t] = bestServer;
+        }
+
+        // Evaluate the repaired solution (also leaves its start times in ws)
+        const EvalResult result = scheduler.evaluateIncremental(next, ws);
+        const int nextFitness = result.state == ScheduleState::SCHEDULED ? static_cast<int>(computeObjective(result)) : INT_MAX;
+
+        // Acceptance and operator scores
+        double points = 0.0;
+        if (nextFitness < INT_MAX && (nextFitness < currFitness || nextFitness <= bestFitness * (1.0 + acceptanceGap))) {
+            if (nextFitness < bestFitness) {
+                points = SCORE_BEST;
+            } else if (nextFitness < currFitness) {
+                points = SCORE_IMPROVED;
+            } else if (next != curr) {
+                points = SCORE_ACCEPTED;
+            }
+            curr = next;
+            currFitness = nextFitness;
+            currStart = ws.start_times;
+            currTopoPos = ws.topo_pos;
+        }
+        destroyWeights.reward(destroyOp, points);
+        repairWeights.reward(repairOp, points);
+        if ((iteration + 1) % segmentLength == 0) {
+            destroyWeights.update(reactionFactor);
+            repairWeights.update(reactionFactor);
+        }
+
+        if (currFitness < bestFitness) {
+            bestFitness = currFitness;
+            best = curr;
+            nonImprovingIterations = 0;
+        } else if (++nonImprovingIterations >= stagnationLimit) {
+            results.status = SolverResult::SolverStatus::STAGNATION;
+            results.observations = "LNS: Stagnation reached after " + std::to_string(nonImprovingIterations) + " iterations without improvement.";
+            utils::dbg << results.observations << "\n";
+            break;
+        }
+    }
+
+    std::ostringstream operatorSummary;
+    operatorSummary << "LNS operators (uses, weight):";
+    for (int k = 0; k < DESTROY_COUNT; ++k) {
+        operatorSummary << " [" << DESTROY_NAMES[k] << ": " << destroyWeights.totalUses[k] << ", " << destroyWeights.weight[k] << "]";
+    }
+    for (int k = 0; k < REPAIR_COUNT; ++k) {
+        operatorSummary << " [" << REPAIR_NAMES[k] << ": " << repairWeights.totalUses[k] << ", " << repairWeights.weight[k] << "]";
+    }
+    utils::dbg << operatorSummary.str() << "\n";
+    if (results.observations.empty()) {
+        results.observations = operatorSummary.str();
+    }
+
+    if (scheduler.schedule(best) != ScheduleState::SCHEDULED) {
+        results.status = SolverResult::SolverStatus::ERROR;
+        results.observations = "LNS: Best candidate infeasible at the end.";
+        utils::dbg << results.observations << "\n";
+        return results;
+    }
+    results.scheduleState = scheduler.getScheduleState();
+    results.bestCandidate = best;
+    results.runtime_ms = utils::getElapsedMs(startTime);
+    results.iterations = iteration;
+    results.scheduleSpan = scheduler.getScheduleSpan();
+    results.finishTimeSum = scheduler.getFinishTimeSum();
+    results.processorsCost = scheduler.getProcessorsCost();
+    results.delayCost = scheduler.getDelayCost();
+    results.memoryUsageKB = utils::getPeakMemoryUsageKB();
+
+    return results;
+}
@@ -0,0 +1,195 @@
+#include "solver.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+SolverResult Solver::parallelTemperingSolve() {
+    /* Parallel tempering (replica exchange) simulated annealing
+     * Key aspects:
+        * - Several replicas of the SA chain run at fixed temperatures of a geometric ladder
+        * - Replicas run their Metropolis steps in parallel, each with its own random stream and workspace
+        * - Every exchangeInterval steps, neighbouring replicas swap states with probability
+        *   min(1, exp((1/T_i - 1/T_j) * (E_i - E_j))), alternating even and odd pairs
+        * - Hot replicas explore while cold ones refine, so no cooling schedule has to be tuned
+        * - A run is reproducible for a given seed and thread count
+    */
+
+    const int maxIterations          = config.pt_maxIterations;
+    const int exchangeInterval       = std::max(1, config.pt_exchangeInterval);
+    const double minTemperature      = config.pt_minTemperature;
+    const double maxTemperature      = config.pt_maxTemperature;
+    const int timeoutMs              = config.pt_timeout_sec*1000;
+    const int stagnationLimit        = config.pt_stagnationLimit;
+    const double perturbationRate    = config.pt_perturbationRate;
+
+#ifdef _OPENMP
+    const int threadCount = omp_get_max_threads();
+#else
+    const int threadCount = 1;
+#endif
+    const int replicaCount = config.pt_replicas > 0 ? config.pt_replicas : std::max(2, threadCount);
+
+    SolverResult results(
+        SolverResult::SolverStatus::NOT_STARTED,
+        scheduler.getInstanceName(),
+        SolverMethod::PARALLEL_TEMPERING,
+        PriorityRefinementMethod::NORMAL_PERTURBATION, // (not used in parallel tempering)
+        ScheduleState::NOT_SCHEDULED,
+        Candidate(scheduler.getTaskCount()),
+        config.alpha,
+        config.beta,
+        config.gamma,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        ""
+    );
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    // Initialize with HEFT or random search to find an initial feasible solution, shared by all replicas
+    Candidate initial(scheduler.getTaskCount());
+    if (!findInitialSolution(initial, config.sa_maxInitTries)) {
+        results.status = SolverResult::SolverStatus::INITIALIZATION_NOT_FEASIBLE;
+        results.observations = "PT: Could not find initial feasible solution";
+        utils::dbg << results.observations << "\n";
+        return results;
+    }
+    const int initialFitness = computeObjective();
+
+    struct Replica {
+        double T;
+        Candidate curr;
+        int currFitness;
+        Candidate best;
+        int bestFitness;
+        utils::Rng rng;
+        ScheduleWorkspace workspace;
+        RepairStats repairStats;
+        int accepted = 0;
+    };
+    std::vector<utils::Rng> streams = rng.split(replicaCount);
+    std::vector<Replica> replicas;
+    replicas.reserve(replicaCount);
+    for (int r = 0; r < replicaCount; ++r) {
+        // Geometric ladder from the coldest (replica 0) to the hottest temperature
+        const double ratio = replicaCount > 1 ? static_cast<double>(r) / (replicaCount - 1) : 0.0;
+        const double T = minTemperature * std::pow(maxTemperature / minTemperature, ratio);
+        replicas.push_back(Replica{T, initial, initialFitness, initial, initialFitness, streams[r], ScheduleWorkspace()});
+    }
+
+    Candidate best = initial;
+    int bestFitness = initialFitness;
+    int exchanges = 0;
+    int exchangeAttempts = 0;
+    int nonImprovingRounds = 0;
+    int iteration = 0;
+    results.status = SolverResult::SolverStatus::COMPLETED; // Default to completed unless timeoutMs or stagnation occurs
+
+    for (int round = 0; iteration < maxIterations; ++round) {
+
+        // timeoutMs check
+        if(utils::getElapsedMs(startTime) >= timeoutMs) {
+            results.status = SolverResult::SolverStatus::TIMEOUT;
+            results.observations = "PT: Timeout reached after " + std::to_string(timeoutMs) + " seconds.";
+            utils::dbg << results.observations << "\n";
+            break;
+        }
+
+        // Metropolis steps of every replica at its own temperature
+        const int steps = std::min(exchangeInterval, maxIterations - iteration);
+        #pragma omp parallel for schedule(static)
+        for (int r = 0; r < replicaCount; ++r) {
+            Replica& replica = replicas[r];
+            Candidate next = replica.curr;
+            for (int step = 0; step < steps; ++step) {
+                next = replica.curr;
+                randomizeCandidate(next, perturbationRate, replica.rng);
+
+                // Acceptance threshold drawn first, so rejected neighbours are cut off early (a step ends the
+                // same way whether its neighbour is infeasible or rejected, so the bound does not change the run)
+                const double u = replica.rng.uniform();
+                const ObjectiveBound bound = u > 0.0 ? getObjectiveBound(replica.currFitness - replica.T * std::log(u)) : ObjectiveBound();
+                const EvalResult result = repairCandidate(next, scheduler.evaluateIncremental(next, replica.workspace, bound), replica.workspace, replica.repairStats, bound);
+                if (result.state != ScheduleState::SCHEDULED) {
+                    continue;
+                }
+                const int nextFitness = static_cast<int>(computeObjective(result));
+                if (nextFitness < replica.currFitness || u < std::exp(-(nextFitness - replica.currFitness) / replica.T)) {
+                    std::swap(replica.curr, next);
+                    replica.currFitness = nextFitness;
+                    replica.accepted++;
+                    if (replica.currFitness < replica.bestFitness) {
+                        replica.best = replica.curr;
+                        replica.bestFitness = replica.currFitness;
+                    }
+                }
+            }
+        }
+        iteration += steps;
+
+        // Replica exchange between neighbouring temperatures (even pairs on even rounds, odd pairs on odd rounds)
+        for (int r = round % 2; r + 1 < replicaCount; r += 2) {
+            Replica& cold = replicas[r];
+            Replica& hot = replicas[r + 1];
+            const double exponent = (1.0 / cold.T - 1.0 / hot.T) * (cold.currFitness - hot.currFitness);
+            exchangeAttempts++;
+            if (exponent >= 0.0 || rng.uniform() < std::exp(exponent)) {
+                std::swap(cold.curr, hot.curr);
+                std::swap(cold.currFitness, hot.currFitness);
+                exchanges++;
+            }
+        }
+
+        // Global best and stagnation check
+        bool improved = false;
+        for (const auto& replica : replicas) {
+            if (replica.bestFitness < bestFitness) {
+                bestFitness = replica.bestFitness;
+                best = replica.best;
+                improved = true;
+            }
+        }
+        nonImprovingRounds = improved ? 0 : nonImprovingRounds + 1;
+        if (nonImprovingRounds >= stagnationLimit) {
+            results.status = SolverResult::SolverStatus::STAGNATION;
+            results.observations = "PT: Stagnation reached after " + std::to_string(nonImprovingRounds) + " exchange rounds without improvement.";
+            utils::dbg << results.observations << "\n";
+            break;
+        }
+    }
+
+    std::ostringstream replicaSummary;
+    replicaSummary << "PT: " << replicaCount << " replicas, " << exchanges << "/" << exchangeAttempts << " exchanges accepted;";
+    for (const auto& replica : replicas) {
+        results.infeasibleCandidates += replica.repairStats.infeasible;
+        results.repairedCandidates += replica.repairStats.repaired;
+        replicaSummary << " [T=" << replica.T << ": " << replica.accepted << " accepted, best " << replica.bestFitness << "]";
+    }
+    utils::dbg << replicaSummary.str() << "\n";
+    if (results.observations.empty()) {
+        results.observations = replicaSummary.str();
+    }
+
+    if (scheduler.schedule(best) != ScheduleState::SCHEDULED) {
+        results.status = SolverResult::SolverStatus::ERROR;
+        results.observations = "PT: Best candidate infeasible at the end.";
+        utils::dbg << results.observations << "\n";
+        return results;
+    }
+    results.scheduleState = scheduler.getScheduleState();
+    results.bestCandidate = best;
+    results.runtime_ms = utils::getElapsedMs(startTime);
+    results.iterations = iteration;
+    results.scheduleSpan = scheduler.getScheduleSpan();
+    results.finishTimeSum = scheduler.getFinishTimeSum();
+    results.processorsCost = scheduler.getProcessorsCost();
+    results.delayCost = scheduler.getDelayCost();
+    results.memoryUsageKB = utils::getPeakMemoryUsageKB();
+
+    return results;
+}
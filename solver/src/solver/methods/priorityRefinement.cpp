@@ -12,18 +12,20 @@ void Solver::refinePrioritiesNormal(Candidate& curr, int currFitness, double T)
     sigma = std::max(sigma, config.sa_sigmaMin); // ensure sigma does not go below minimum
     const int maxIterations = config.sa_refinementIterations;
 
-    // For each task, perturb its priority with a normal distribution
+    // For each task, perturb its priority with a normal distribution (deviates drawn in one batch)
+    const size_t taskCount = scheduler.getTaskCount();
+    std::vector<double> noise(taskCount);
     int noImproveCount = 0;
     for(int iter = 0; iter < maxIterations; ++iter){
         Candidate trial = curr;
 
-        for (size_t i = 0; i < scheduler.getTaskCount(); ++i) {
-            trial.priorities[i] += utils::randNormal(0, sigma);
-            trial.priorities[i] = utils::clamp(trial.priorities[i], 0.0, 1.0);
+        rng.fillNormal(noise.data(), taskCount, 0.0, sigma);
+        for (size_t i = 0; i < taskCount; ++i) {
+            trial.priorities[i] = utils::clamp(trial.priorities[i] + noise[i], 0.0, 1.0);
         }
 
-        // If the new candidate is better, accept it
-        if (scheduler.schedule(trial) == ScheduleState::SCHEDULED) {
+        // If the new candidate is better, accept it (worse ones are cut off by the bound)
+        if (scheduler.schedule(trial, getObjectiveBound(currFitness)) == ScheduleState::SCHEDULED) {
             int fitness = computeObjective();
             if (fitness < currFitness) {
                 curr = trial;
@@ -49,6 +51,8 @@ void Solver::refinePrioritiesPSO(Candidate& curr, int currFitness, double T) {
         * - Velocity clamping to control exploration
         * - Temperature-dependent parameters to adapt search behavior
         * - Iterative updates to refine priorities over several iterations
+        * - Particles keep the server allocation of curr, only priorities move
+        * - All particles of an iteration are evaluated in parallel (Scheduler::evaluateBatch)
         * - Final update of curr to the best found solution
     */
 
@@ -64,34 +68,37 @@ void Solver::refinePrioritiesPSO(Candidate& curr, int currFitness, double T) {
     velocityClamp = std::max(velocityClamp, 0.1); // ensure velocity
 
     const size_t taskCount = scheduler.getTaskCount();
-
-    // Initialize swarm
-    struct Particle {
-        Candidate position;
-        std::vector<double> velocity;
-        Candidate bestPosition;
-        int bestFitness;
-
-        Particle(size_t taskCount) : 
-            position(taskCount), 
-            velocity(taskCount, 0.0), 
-            bestPosition(taskCount), 
-            bestFitness(INT_MAX) {}
-    };
-
-    std::vector<Particle> swarm; // Start from scratch (no refinement from curr)
-    for (int i = 0; i < swarmSize; ++i) { // Randomly initialize positions and velocities
-        Particle particle(taskCount);
-        for (size_t j = 0; j < taskCount; ++j) {
-            particle.position.priorities[j] = static_cast<double>(rand()) / RAND_MAX;
-            particle.velocity[j] = (static_cast<double>(rand()) / RAND_MAX - 0.5) * 2.0; // random velocity in [-1, 1]
-        }
-        if(scheduler.schedule(particle.position) == ScheduleState::SCHEDULED) {
-            int fitness = computeObjective();
-            particle.bestPosition = particle.position;
-            particle.bestFitness = fitness;
+    const size_t cells = static_cast<size_t>(std::max(swarmSize, 0)) * taskCount;
+
+    // Swarm stored as contiguous swarmSize x taskCount matrices (row i is particle i)
+    std::vector<double> positions(cells);
+    std::vector<double> velocities(cells);
+    std::vector<double> bestPositions(cells);
+    std::vector<int> bestFitness(swarmSize, INT_MAX);
+
+    // Random numbers are drawn in batches
+    std::vector<double> r1(cells);
+    std::vector<double> r2(cells);
+
+    // Particles only move priorities, servers are those of curr (start from scratch, no refinement from curr)
+    std::vector<Candidate> particles(swarmSize, curr);
+    std::vector<EvalResult> evaluations;
+    std::vector<ObjectiveBound> bounds(swarmSize);
+
+    rng.fillUniform(positions.data(), cells); // Randomly initialize positions and velocities
+    rng.fillUniform(velocities.data(), cells);
+    for (size_t c = 0; c < cells; ++c) {
+        velocities[c] = (velocities[c] - 0.5) * 2.0; // random velocity in [-1, 1]
+    }
+    for (int i = 0; i < swarmSize; ++i) {
+        std::copy(positions.begin() + i * taskCount, positions.begin() + (i + 1) * taskCount, particles[i].priorities.begin());
+    }
+    scheduler.evaluateBatch(particles, evaluations);
+    for (int i = 0; i < swarmSize; ++i) {
+        if (evaluations[i].state == ScheduleState::SCHEDULED) {
+            std::copy(positions.begin() + i * taskCount, positions.begin() + (i + 1) * taskCount, bestPositions.begin() + i * taskCount);
+            bestFitness[i] = static_cast<int>(computeObjective(evaluations[i]));
         }
-        swarm.push_back(particle);
     }
 
     Candidate globalBestPosition = curr;
@@ -99,37 +106,49 @@ void Solver::refinePrioritiesPSO(Candidate& curr, int currFitness, double T) {
 
     // PSO main loop
     for (int iter = 0; iter < maxIterations; ++iter) {
-        for (auto& particle : swarm) {
-            // Update velocity and position
+        rng.fillUniform(r1.data(), cells);
+        rng.fillUniform(r2.data(), cells);
+
+        // Update velocity and position of every particle (contiguous rows, vectorizable)
+        const double* globalBest = globalBestPosition.priorities.data();
+        for (int i = 0; i < swarmSize; ++i) {
+            double* position = positions.data() + i * taskCount;
+            double* velocity = velocities.data() + i * taskCount;
+            const double* bestPosition = bestPositions.data() + i * taskCount;
+            const double* rand1 = r1.data() + i * taskCount;
+            const double* rand2 = r2.data() + i * taskCount;
+            #pragma omp simd
             for (size_t j = 0; j < taskCount; ++j) {
-                double r1 = static_cast<double>(rand()) / RAND_MAX;
-                double r2 = static_cast<double>(rand()) / RAND_MAX;
+                double v = inertiaWeight * velocity[j]
+                    + cognitiveCoefficient * rand1[j] * (bestPosition[j] - position[j])
+                    + socialCoefficient * rand2[j] * (globalBest[j] - position[j]);
+                v = std::min(std::max(v, -velocityClamp), velocityClamp); // Clamp velocity
+                velocity[j] = v;
+                position[j] = std::min(std::max(position[j] + v, 0.0), 1.0); // Update position
+            }
+            std::copy(position, position + taskCount, particles[i].priorities.begin());
 
-                particle.velocity[j] = inertiaWeight * particle.velocity[j]
-                    + cognitiveCoefficient * r1 * (particle.bestPosition.priorities[j] - particle.position.priorities[j])
-                    + socialCoefficient * r2 * (globalBestPosition.priorities[j] - particle.position.priorities[j]);
+            // Positions improving neither the personal nor the global best are cut off
+            bounds[i] = getObjectiveBound(std::max(bestFitness[i], globalBestFitness));
+        }
 
-                // Clamp velocity
-                particle.velocity[j] = utils::clamp(particle.velocity[j], -velocityClamp, velocityClamp);
+        // Evaluate all particles in parallel
+        scheduler.evaluateBatch(particles, evaluations, bounds);
 
-                // Update position
-                particle.position.priorities[j] += particle.velocity[j];
-                particle.position.priorities[j] = utils::clamp(particle.position.priorities[j], 0.0, 1.0);
+        for (int i = 0; i < swarmSize; ++i) {
+            if (evaluations[i].state != ScheduleState::SCHEDULED) {
+                continue;
             }
-
-            // Evaluate fitness
-            if (scheduler.schedule(particle.position) == ScheduleState::SCHEDULED) {
-                int fitness = computeObjective();
-                // Update personal best
-                if (fitness < particle.bestFitness) {
-                    particle.bestPosition = particle.position;
-                    particle.bestFitness = fitness;
-                }
-                // Update global best
-                if (fitness < globalBestFitness) {
-                    globalBestPosition = particle.position;
-                    globalBestFitness = fitness;
-                }
+            const int fitness = static_cast<int>(computeObjective(evaluations[i]));
+            // Update personal best
+            if (fitness < bestFitness[i]) {
+                std::copy(positions.begin() + i * taskCount, positions.begin() + (i + 1) * taskCount, bestPositions.begin() + i * taskCount);
+                bestFitness[i] = fitness;
+            }
+            // Update global best
+            if (fitness < globalBestFitness) {
+                globalBestPosition = particles[i];
+                globalBestFitness = fitness;
             }
         }
     }
@@ -1,4 +1,7 @@
 #include "solver.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 SolverResult Solver::randomSearchSolve() {
     // Performs random search to find a feasible scheduling solution
@@ -35,89 +38,195 @@ SolverResult Solver::randomSearchSolve() {
     int bestFitness = INT_MAX;
     Candidate curr = scheduler.getCandidateFromCurrentSchedule();
     Candidate best(scheduler.getTaskCount());
-    Scheduler bestScheduler;  // Snapshot of the scheduler when the best solution was found
+    ScheduleSnapshot bestSnapshot;  // Schedule when the best solution was found
     bool foundFeasible = false;
 
     if(scheduler.getNonMISTServerCount() == 0) {
         results.status = SolverResult::SolverStatus::ERROR;
         results.observations = "No allocable servers available.";
-        utils::dbg << results.observations << "\n";
+        utils::threadDbg() << results.observations << "\n";
         return results;
     }
 
-    double improvement = 0.0;
-    int nonImprovingGenerations = 0;
-    int iteration;
-    results.status = SolverResult::SolverStatus::COMPLETED; // Default to completed unless timeoutMs or stagnation occurs
+    // Schedule may be already initialized before the search (e.g., from an initial solution)
+    // So, it is the first sample of the search
+    if (scheduler.getScheduleState() == ScheduleState::SCHEDULED) {
+        if (breakOnFirstFeasible) { // Used to initialize other solvers with a quick feasible solution
+            results.status = SolverResult::SolverStatus::COMPLETED;
+            results.observations = "Feasible solution found after 1 iterations.";
+            results.bestCandidate = curr;
+            results.runtime_ms = utils::getElapsedMs(startTime);
+            results.iterations = 1;
+            results.scheduleSpan = scheduler.getScheduleSpan();
+            results.finishTimeSum = scheduler.getFinishTimeSum();
+            results.processorsCost = scheduler.getProcessorsCost();
+            results.delayCost = scheduler.getDelayCost();
+            results.memoryUsageKB = utils::getPeakMemoryUsageKB();
+            results.scheduleState = scheduler.getScheduleState();
+            utils::threadDbg() << results.observations << "\n";
+            return results;
+        }
+        bestFitness = computeObjective();
+        best = curr;
+        scheduler.saveSnapshot(best, bestSnapshot);  // save schedule at this point
+        foundFeasible = true;
+    }
 
-    for (iteration = 0; iteration < maxIterations; ++iteration) {
+    /* Parallel search
+     * - Each worker thread random-walks from curr with its own stream and workspace
+     * - Samples are numbered globally and dealt round-robin (worker w takes samples w, w + W, ...),
+     *   so the samples of each worker only depend on the seed
+     * - Each worker keeps its own best and stagnation counter, the bests are merged at the end
+     * - With breakOnFirstFeasible, the lowest feasible sample number is published atomically and
+     *   workers stop as soon as their next sample comes after it, so the returned solution is
+     *   the same for a given seed and thread count
+    */
+#ifdef _OPENMP
+    const int workerCount = std::max(1, std::min(omp_get_max_threads(), maxIterations));
+#else
+    const int workerCount = 1;
+#endif
+    struct Worker {
+        Candidate best;
+        int bestFitness = INT_MAX;
+        int bestSample = INT_MAX;
+        int samples = 0;
+        RepairStats repairStats;
+        SolverResult::SolverStatus status = SolverResult::SolverStatus::COMPLETED;
+        Worker(const Candidate& start) : best(start) {}
+    };
+    std::vector<Worker> workers(workerCount, Worker(curr));
+    std::vector<utils::Rng> streams = rng.split(workerCount);
+    std::atomic<int> firstFeasibleSample{INT_MAX};
 
-        // timeoutMs check
-        if(utils::getElapsedMs(startTime) >= timeoutMs) {
-            results.status = SolverResult::SolverStatus::TIMEOUT;
-            results.observations = "GA: Timeout reached after " + std::to_string(timeoutMs) + " seconds.";
-            utils::dbg << results.observations << "\n";
-            break;
-        }
+    #pragma omp parallel for schedule(static, 1) num_threads(workerCount)
+    for (int w = 0; w < workerCount; ++w) {
+        Worker& worker = workers[w];
+        ScheduleWorkspace ws;
+        Candidate sample = curr;
+        const int initialBest = bestFitness; // feasible initial schedule, if any
+        double improvement = 0.0;
+        int nonImprovingGenerations = 0;
+
+        for (int n = w; n < maxIterations; n += workerCount) {
 
-        // Schedule may be already initialized before entering the loop (e.g., from an initial solution)
-        // So, best fitness check must be done here as well
-        if (scheduler.getScheduleState() == ScheduleState::SCHEDULED) { // feasible
-            if (breakOnFirstFeasible) { // Used to initialize other solvers with a quick feasible solution
-                results.status = SolverResult::SolverStatus::COMPLETED;
-                results.observations = "Feasible solution found after " + std::to_string(iteration + 1) + " iterations.";
-                results.bestCandidate = curr;
-                results.runtime_ms = utils::getElapsedMs(startTime);
-                results.iterations = iteration + 1;
-                results.scheduleSpan = scheduler.getScheduleSpan();
-                results.finishTimeSum = scheduler.getFinishTimeSum();
-                results.processorsCost = scheduler.getProcessorsCost();
-                results.delayCost = scheduler.getDelayCost();
-                results.memoryUsageKB = utils::getPeakMemoryUsageKB();
-                results.scheduleState = scheduler.getScheduleState();
-                utils::dbg << results.observations << "\n";
-                return results;
+            if (breakOnFirstFeasible && n > firstFeasibleSample.load(std::memory_order_acquire)) {
+                break; // another worker found a feasible solution earlier in the sample order
             }
 
-            // Check if this is the best solution found so far
-            //int fitness = scheduler.getScheduleSpan();
-            int fitness = computeObjective();
-            if (fitness < bestFitness) {
-                improvement = bestFitness - fitness;  // compute before updating bestFitness
-                bestFitness = fitness;
-                best = curr;
-                bestScheduler = scheduler;  // save scheduler state at this point
-                foundFeasible = true;
-                nonImprovingGenerations = 0;
-            } else {
-                improvement = 0.0;
+            // timeoutMs check
+            if(utils::getElapsedMs(startTime) >= timeoutMs) {
+                worker.status = SolverResult::SolverStatus::TIMEOUT;
+                break;
             }
 
-            // Stagnation check
-            if (improvement < stagnationThreshold) {
-                nonImprovingGenerations++;
-                if (nonImprovingGenerations >= stagnationLimit) {
-                    results.status = SolverResult::SolverStatus::STAGNATION;
-                    results.observations = "Random Search: Stagnation reached after " + std::to_string(nonImprovingGenerations) + " iterations without improvement.";
-                    utils::dbg << results.observations << "\n";
-                    break;
+            randomizeCandidate(sample, perturbationRate, streams[w]);
+
+            // try to schedule current candidate (only needed in full if it beats the best one)
+            const int incumbentFitness = std::min(worker.bestFitness, initialBest);
+            EvalResult result = scheduler.evaluateIncremental(sample, ws, breakOnFirstFeasible ? ObjectiveBound() : getObjectiveBound(incumbentFitness));
+            if (breakOnFirstFeasible) {
+                result = repairCandidate(sample, result, ws, worker.repairStats); // Looking for a starting point: repair infeasible samples
+            }
+            worker.samples++;
+
+            if (result.state == ScheduleState::SCHEDULED && breakOnFirstFeasible) {
+                worker.best = sample;
+                worker.bestFitness = static_cast<int>(computeObjective(result));
+                worker.bestSample = n;
+                int published = firstFeasibleSample.load(std::memory_order_relaxed);
+                while (n < published && !firstFeasibleSample.compare_exchange_weak(published, n, std::memory_order_acq_rel)) {}
+                break;
+            }
+
+            // Stagnation counts feasible samples and samples cut off by the best fitness. A cut off sample may have been
+            // infeasible (the simulation stopped before finding out), so bounded runs stagnate sooner than unbounded
+            // ones would, where only feasible samples count
+            if (result.state == ScheduleState::SCHEDULED || result.state == ScheduleState::BOUND_EXCEEDED) {
+                // Check if this is the best solution found so far
+                const int fitness = result.state == ScheduleState::SCHEDULED ? static_cast<int>(computeObjective(result)) : INT_MAX; // a cut off candidate cannot improve the best
+                if (fitness < incumbentFitness) {
+                    improvement = incumbentFitness - fitness;  // compute before updating the best
+                    worker.best = sample;
+                    worker.bestFitness = fitness;
+                    worker.bestSample = n;
+                    nonImprovingGenerations = 0;
+                } else {
+                    improvement = 0.0;
+                }
+
+                // Stagnation check
+                if (improvement < stagnationThreshold) {
+                    nonImprovingGenerations++;
+                    if (nonImprovingGenerations >= stagnationLimit) {
+                        worker.status = SolverResult::SolverStatus::STAGNATION;
+                        break;
+                    }
                 }
             }
         }
+    }
 
-        randomizeCandidate(curr, perturbationRate);
+    // Merge: best of the workers (lowest sample number on ties, or first feasible sample with
+    // breakOnFirstFeasible), timeout if any worker timed out, stagnation if all of them stagnated
+    int iteration = foundFeasible ? 1 : 0;
+    int bestSample = INT_MAX;
+    int stagnated = 0;
+    results.status = SolverResult::SolverStatus::COMPLETED; // Default to completed unless timeoutMs or stagnation occurs
+    for (const auto& worker : workers) {
+        iteration += worker.samples;
+        results.infeasibleCandidates += worker.repairStats.infeasible;
+        results.repairedCandidates += worker.repairStats.repaired;
+        const bool better = breakOnFirstFeasible
+            ? worker.bestSample < bestSample
+            : worker.bestFitness < bestFitness || (worker.bestFitness == bestFitness && worker.bestSample < bestSample);
+        if (better) {
+            bestFitness = worker.bestFitness;
+            bestSample = worker.bestSample;
+            best = worker.best;
+        }
+        if (worker.status == SolverResult::SolverStatus::TIMEOUT) {
+            results.status = SolverResult::SolverStatus::TIMEOUT;
+        }
+        if (worker.status == SolverResult::SolverStatus::STAGNATION) {
+            stagnated++;
+        }
+    }
+    if (results.status == SolverResult::SolverStatus::TIMEOUT) {
+        results.observations = "RS: Timeout reached after " + std::to_string(timeoutMs) + " seconds.";
+        utils::threadDbg() << results.observations << "\n";
+    } else if (stagnated == workerCount) {
+        results.status = SolverResult::SolverStatus::STAGNATION;
+        results.observations = "Random Search: Stagnation reached after " + std::to_string(stagnationLimit) + " iterations without improvement.";
+        utils::threadDbg() << results.observations << "\n";
+    }
 
-        scheduler.schedule(curr); // try to schedule current candidate
+    if (breakOnFirstFeasible && bestSample < INT_MAX) {
+        scheduler.schedule(best);
+        results.status = SolverResult::SolverStatus::COMPLETED;
+        results.observations = "Feasible solution found after " + std::to_string(bestSample + 1) + " iterations.";
+        results.bestCandidate = best;
+        results.runtime_ms = utils::getElapsedMs(startTime);
+        results.iterations = bestSample + 1;
+        results.scheduleSpan = scheduler.getScheduleSpan();
+        results.finishTimeSum = scheduler.getFinishTimeSum();
+        results.processorsCost = scheduler.getProcessorsCost();
+        results.delayCost = scheduler.getDelayCost();
+        results.memoryUsageKB = utils::getPeakMemoryUsageKB();
+        results.scheduleState = scheduler.getScheduleState();
+        utils::threadDbg() << results.observations << "\n";
+        return results;
     }
 
     // Final scheduling with the best candidate found
     if (scheduler.schedule(best) != ScheduleState::SCHEDULED) {
-        if (foundFeasible) {
+        if (bestSnapshot.result.state == ScheduleState::SCHEDULED) {
             // Re-scheduling the best candidate failed (e.g. the imported solution uses multi-hop
             // routing not modelled by the direct-connection delay matrix), but we did find a
             // feasible solution during the search.  Restore the saved scheduler snapshot so the
             // caller sees a SCHEDULED state with the best-known results.
-            scheduler = bestScheduler;
+            scheduler.restoreSnapshot(bestSnapshot);
+            best = bestSnapshot.candidate;
             results.runtime_ms = utils::getElapsedMs(startTime);
             results.iterations = iteration;
             results.scheduleSpan = scheduler.getScheduleSpan();
@@ -128,11 +237,11 @@ SolverResult Solver::randomSearchSolve() {
             results.scheduleState = scheduler.getScheduleState();
             results.bestCandidate = best;
             results.observations = "Feasible solution found (best candidate could not be re-scheduled; returning best known state).";
-            utils::dbg << results.observations << "\n";
+            utils::threadDbg() << results.observations << "\n";
         } else {
             results.status = SolverResult::SolverStatus::SOLUTION_NOT_FOUND;
             results.observations = "No feasible solution found after " + std::to_string(iteration) + " iterations.";
-            utils::dbg << results.observations << "\n";
+            utils::threadDbg() << results.observations << "\n";
         }
     }else{
         results.runtime_ms = utils::getElapsedMs(startTime);
@@ -1,16 +1,20 @@
 #include "solver.h"
 
 void Solver::randomizeCandidate(Candidate& candidate, double perturbationRate) {
+    randomizeCandidate(candidate, perturbationRate, rng);
+}
+
+void Solver::randomizeCandidate(Candidate& candidate, double perturbationRate, utils::Rng& rng) const {
     for (size_t i = 0; i < scheduler.getTaskCount(); ++i) {
-        if (rand() / (double)RAND_MAX < perturbationRate) {
+        if (rng.uniform() < perturbationRate) {
             if (!scheduler.getTask(i).hasFixedAllocation()){
-                candidate.server_indices[i] = scheduler.getNonMISTServerIdx(rand() % scheduler.getNonMISTServerCount());
+                candidate.server_indices[i] = scheduler.getAllowedServerIdx(i, rng.below(scheduler.getAllowedServerCount(i)));
                 continue; // Priority doesnt matter for fixed allocation tasks
             }
         }
-        if (rand() / (double)RAND_MAX < perturbationRate) {
-            candidate.priorities[i] += utils::randNormal(0, 0.05);
+        if (rng.uniform() < perturbationRate) {
+            candidate.priorities[i] += rng.normal(0.0, 0.05);
             candidate.priorities[i] = utils::clamp(candidate.priorities[i], 0.0, 1.0);
         }
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,175 @@
+#include "solver.h"
+
+namespace {
+
+// Server hosting task idx in a candidate (the fixed one if the task has a fixed allocation)
+inline int assignedServer(const CompiledInstance& inst, const Candidate& candidate, int idx) {
+    return inst.fixed_server[idx] >= 0 ? inst.fixed_server[idx] : candidate.server_indices[idx];
+}
+
+// Allowed server (other than exclude) where task idx would finish first, given the servers state and the
+// placed predecessors left in ws by the failed evaluation. Servers with memory and utilization left for
+// the task and meeting its deadline come first, ties are broken by the weighted delay and cost.
+// Servers without capacity are only considered if requireCapacity is false. Returns -1 if none is reachable.
+int findRepairServer(const CompiledInstance& inst, const ScheduleWorkspace& ws, double beta, double gamma,
+                     int idx, int exclude, bool requireCapacity, long long& bestFinish) {
+    const long long latestFinish = inst.D[idx] > 0 ? (long long)inst.a[idx] + inst.D[idx] : LLONG_MAX;
+    int best = -1;
+    bool bestFits = false;
+    bool bestMisses = true;
+    double bestCost = 0.0;
+    for (int s = 0; s < inst.server_count; ++s) {
+        if (s == exclude || !inst.isAllowed(idx, s)) continue;
+        const bool fits = ws.server_memory_left[s] >= inst.M[idx] && ws.server_utilization_left[s] >= inst.u[idx];
+        if (requireCapacity && !fits) continue;
+
+        long long ready = std::max((long long)inst.a[idx], ws.server_ready[s]);
+        long long addedDelay = 0;
+        bool reachable = true;
+        for (int k = inst.pred_offsets[idx]; k < inst.pred_offsets[idx + 1] && reachable; ++k) {
+            const int p = inst.pred_idxs[k];
+            const int ps = ws.server_of[p];
+            if (ps < 0) continue; // not placed by the failed evaluation
+            const int delay = ps == s ? 0 : inst.getDelay(ps, s);
+            if (delay == INT_MAX) {
+                reachable = false;
+                break;
+            }
+            ready = std::max(ready, (long long)ws.finish_times[p] + delay);
+            addedDelay += delay;
+        }
+        if (!reachable) continue;
+
+        const long long finish = ready + inst.C[idx];
+        const bool misses = finish > latestFinish;
+        const double cost = beta * static_cast<double>(addedDelay) + gamma * static_cast<double>(inst.server_cost[s]);
+        const bool better = best < 0
+            || fits > bestFits
+            || (fits == bestFits && (misses < bestMisses
+            || (misses == bestMisses && (finish < bestFinish || (finish == bestFinish && cost < bestCost)))));
+        if (better) {
+            best = s;
+            bestFits = fits;
+            bestMisses = misses;
+            bestFinish = finish;
+            bestCost = cost;
+        }
+    }
+    return best;
+}
+
+// Gives the highest priority to task idx and to the chain of predecessors whose data arrived last,
+// so the chain runs before the tasks competing for its servers. Priorities are not limited to [0, 1]
+// (e.g. the candidate of an imported schedule numbers them 1 to N), so the chain goes just above the
+// current maximum. Returns false if the whole chain already had the maximum priority.
+bool raiseCriticalChain(const CompiledInstance& inst, const ScheduleWorkspace& ws, Candidate& candidate, int idx) {
+    const double top = *std::max_element(candidate.priorities.begin(), candidate.priorities.end());
+    auto forEachInChain = [&](auto&& visit) {
+        int server = assignedServer(inst, candidate, idx);
+        for (int v = idx; v >= 0; ) {
+            visit(v);
+            int critical = -1;
+            long long latest = inst.a[v];
+            for (int k = inst.pred_offsets[v]; k < inst.pred_offsets[v + 1]; ++k) {
+                const int p = inst.pred_idxs[k];
+                const int ps = ws.server_of[p];
+                if (ps < 0 || server < 0) continue;
+                const int delay = ps == server ? 0 : inst.getDelay(ps, server);
+                const long long arrival = (long long)ws.finish_times[p] + (delay == INT_MAX ? 0 : delay);
+                if (arrival > latest) {
+                    latest = arrival;
+                    critical = p;
+                }
+            }
+            v = critical;
+            server = v >= 0 ? ws.server_of[v] : -1;
+        }
+    };
+
+    bool changed = false;
+    forEachInChain([&](int v) { changed = changed || candidate.priorities[v] < top; });
+    if (changed) {
+        const double raised = std::nextafter(top, std::numeric_limits<double>::infinity());
+        forEachInChain([&](int v) { candidate.priorities[v] = raised; });
+    }
+    return changed;
+}
+
+} // namespace
+
+EvalResult Solver::repairCandidate(Candidate& candidate, EvalResult result, ScheduleWorkspace& ws, RepairStats& stats, const ObjectiveBound& bound) const {
+    // Turns an infeasible candidate into a feasible one with a few targeted moves, using the failure
+    // reason and the failed task reported by the evaluation (result must come from the last evaluation with ws):
+    // - Memory or utilization: the task (or, if fixed, the last movable task on the same server) moves to the
+    //   server with capacity left where it finishes first
+    // - Disconnected predecessors, MIST or invalid server: the task moves to the reachable server where it finishes first
+    // - Deadline: the task moves to a server where it finishes earlier, else its critical chain gets the highest priority
+    // Every move is followed by an incremental re-evaluation, up to config.repairSteps moves.
+    if (result.failed_task < 0) {
+        return result; // feasible, stopped by the bound or not caused by a task
+    }
+    stats.infeasible++;
+    if (ws.screened) {
+        // Rejected by the staged screening: the moves below need the state left by the timing simulation
+        result = scheduler.evaluateUnstaged(candidate, ws, bound);
+    }
+
+    const CompiledInstance& inst = scheduler.getCompiledInstance();
+    for (int step = 0; step < config.repairSteps && result.failed_task >= 0; ++step) {
+        const int t = result.failed_task;
+        const int current = assignedServer(inst, candidate, t);
+        const bool fixed = inst.fixed_server[t] >= 0;
+        long long finish = 0;
+        bool changed = false;
+
+        switch (result.state.schedule_state) {
+            case ScheduleState::MEMORY_UNFEASIBLE:
+            case ScheduleState::UTILIZATION_UNFEASIBLE: {
+                const int server = ws.server_of[t];
+                int moved = -1;
+                for (int pos = ws.placed_count - 1; pos >= 0 && moved < 0; --pos) {
+                    const int idx = ws.topo_order[pos];
+                    if (ws.server_of[idx] == server && inst.fixed_server[idx] < 0) {
+                        moved = idx;
+                    }
+                }
+                const int target = moved >= 0 ? findRepairServer(inst, ws, config.beta, config.gamma, moved, server, true, finish) : -1;
+                if (target >= 0) {
+                    candidate.server_indices[moved] = target;
+                    changed = true;
+                }
+                break;
+            }
+            case ScheduleState::PRECEDENCES_ERROR:
+            case ScheduleState::CANDIDATE_ERROR: {
+                const int target = fixed ? -1 : findRepairServer(inst, ws, config.beta, config.gamma, t, current, false, finish);
+                if (target >= 0) {
+                    candidate.server_indices[t] = target;
+                    changed = true;
+                }
+                break;
+            }
+            case ScheduleState::DEADLINE_MISSED: {
+                const int target = fixed ? -1 : findRepairServer(inst, ws, config.beta, config.gamma, t, current, false, finish);
+                if (target >= 0 && finish < ws.finish_times[t]) {
+                    candidate.server_indices[t] = target;
+                    changed = true;
+                } else {
+                    changed = raiseCriticalChain(inst, ws, candidate, t);
+                }
+                break;
+            }
+            default:
+                break;
+        }
+        if (!changed) {
+            break; // no move left for this failure
+        }
+        result = scheduler.evaluateIncremental(candidate, ws, bound);
+    }
+
+    if (result.state == ScheduleState::SCHEDULED) {
+        stats.repaired++;
+    }
+    return result;
+}
@@ -12,6 +12,7 @@ SolverResult Solver::simulatedAnnealingSolve() {
     const int stagnationLimit        = config.sa_stagnationLimit;
     const double perturbationRate    = config.sa_perturbationRate;
     const double stagnationThreshold = config.sa_stagnationThreshold;
+    const double restartGap          = config.sa_restartGap;
 
     SolverResult results(
         SolverResult::SolverStatus::NOT_STARTED,
@@ -35,28 +36,34 @@ SolverResult Solver::simulatedAnnealingSolve() {
 
     auto startTime = std::chrono::high_resolution_clock::now();
 
-    // Initialize using random search to find an initial feasible solution
-    config.rs_breakOnFirstFeasible = true;
-    config.rs_maxIterations = maxInitTries;
-    SolverResult rsResult = randomSearchSolve();
-    if (scheduler.getScheduleState() != ScheduleState::SCHEDULED) {
+    // Initialize with HEFT or random search to find an initial feasible solution
+    Candidate initial(scheduler.getTaskCount());
+    if (!findInitialSolution(initial, maxInitTries)) {
         results.status = SolverResult::SolverStatus::INITIALIZATION_NOT_FEASIBLE;
         results.observations = "SA: Could not find initial feasible solution";
-        utils::dbg << results.observations << "\n";
+        utils::threadDbg() << results.observations << "\n";
         return results;
     }
 
     int currFitness = computeObjective();
-    Candidate best = rsResult.bestCandidate;
-    Candidate curr = rsResult.bestCandidate;
+    Candidate best = initial;
+    Candidate curr = initial;
     Candidate next(scheduler.getTaskCount());
+    ScheduleWorkspace workspace; // Neighbors are evaluated incrementally, the scheduler only keeps accepted states
+    RepairStats repairStats;
     int bestFitness = currFitness;
-    Scheduler bestScheduler = scheduler; // Snapshot when best was last confirmed feasible
-    bool foundFeasible = true; // RS found an initial feasible solution
+    ScheduleSnapshot bestSnapshot; // Schedule of the best candidate when it was last confirmed feasible
+    scheduler.saveSnapshot(best, bestSnapshot);
+    bool foundFeasible = true; // An initial feasible solution was found
     double T = initialTemperature;
 
     double improvement = 0.0;
     int nonImprovingIterations = 0;
+    int restarts = 0;
+    int incumbentUpdates = 0;
+    if (incumbent != nullptr && incumbent->offer(best, bestFitness)) {
+        incumbentUpdates++;
+    }
     int iteration;
     results.status = SolverResult::SolverStatus::COMPLETED; // Default to completed unless timeoutMs or stagnation occurs
 
@@ -66,14 +73,24 @@ SolverResult Solver::simulatedAnnealingSolve() {
         if(utils::getElapsedMs(startTime) >= timeoutMs) {
             results.status = SolverResult::SolverStatus::TIMEOUT;
             results.observations = "GA: Timeout reached after " + std::to_string(timeoutMs) + " seconds.";
-            utils::dbg << results.observations << "\n";
+            utils::threadDbg() << results.observations << "\n";
             break;
         }
 
+        // Multi-start: a chain that fell far behind the shared incumbent continues from it
+        if (incumbent != nullptr && restartGap >= 0.0) {
+            const int incumbentFitness = incumbent->getFitness();
+            if (incumbentFitness < bestFitness && currFitness > incumbentFitness * (1.0 + restartGap)) {
+                currFitness = incumbent->load(curr);
+                restarts++;
+            }
+        }
+
         bool hasFeasibleNeighbor = false;
         int nextFitness = INT_MAX;
 
-        // Try several neighbors at this temperature
+        // Try several neighbors at this temperature. Neighbors are evaluated without an objective bound:
+        // a cut-off neighbor could still be infeasible, and an infeasible one must not end the tries.
         for (int tr = 0; tr < maxNeighborTries && !hasFeasibleNeighbor; ++tr) {
 
             next = curr;
@@ -94,8 +111,10 @@ SolverResult Solver::simulatedAnnealingSolve() {
             */
             randomizeCandidate(next, perturbationRate); // 20% perturbation rate
 
-            if (scheduler.schedule(next) == ScheduleState::SCHEDULED) { // schedule() is expensive, so only call it once per neighbor
-                nextFitness = computeObjective();
+            // Infeasible neighbors are repaired before trying another one
+            const EvalResult nextResult = repairCandidate(next, scheduler.evaluateIncremental(next, workspace), workspace, repairStats);
+            if (nextResult.state == ScheduleState::SCHEDULED) {
+                nextFitness = static_cast<int>(computeObjective(nextResult));
                 hasFeasibleNeighbor = true; // found a feasible neighbor, exit inner loop
                 if (nextFitness < currFitness){
                     break; // improvement found — stop searching
@@ -119,7 +138,7 @@ SolverResult Solver::simulatedAnnealingSolve() {
             // probabilistic acceptance
             double delta = nextFitness - currFitness;
             double prob  = exp(-delta / T);
-            double r     = static_cast<double>(rand()) / RAND_MAX;
+            double r     = rng.uniform();
             if (r < prob) accept = true;
         }
 
@@ -135,7 +154,10 @@ SolverResult Solver::simulatedAnnealingSolve() {
                 best     = curr;
                 // Save scheduler snapshot when best is updated (re-schedule to capture the state)
                 if (scheduler.schedule(best) == ScheduleState::SCHEDULED) {
-                    bestScheduler = scheduler;
+                    scheduler.saveSnapshot(best, bestSnapshot);
+                }
+                if (incumbent != nullptr && incumbent->offer(best, bestFitness)) {
+                    incumbentUpdates++;
                 }
                 nonImprovingIterations = 0;
             }else{
@@ -148,7 +170,7 @@ SolverResult Solver::simulatedAnnealingSolve() {
                 if (nonImprovingIterations >= stagnationLimit) {
                     results.status = SolverResult::SolverStatus::STAGNATION;
                     results.observations = "SA: Stagnation reached after " + std::to_string(nonImprovingIterations) + " iterations without improvement.";
-                    utils::dbg << results.observations << "\n";
+                    utils::threadDbg() << results.observations << "\n";
                     break;
                 }
             }
@@ -157,17 +179,24 @@ SolverResult Solver::simulatedAnnealingSolve() {
         T *= coolingRate;
     }
 
+    results.infeasibleCandidates = repairStats.infeasible;
+    results.repairedCandidates = repairStats.repaired;
+    if (incumbent != nullptr) {
+        results.chains.push_back({iteration, bestFitness, restarts, incumbentUpdates});
+    }
+
     if (bestFitness < INT_MAX){
         if (scheduler.schedule(best) != ScheduleState::SCHEDULED) {
             // Re-scheduling the best candidate failed. Restore from saved snapshot.
             if (foundFeasible) {
-                scheduler = bestScheduler;
+                scheduler.restoreSnapshot(bestSnapshot);
+                best = bestSnapshot.candidate;
                 results.observations = "SA: Best candidate could not be re-scheduled; returning best known state.";
-                utils::dbg << results.observations << "\n";
+                utils::threadDbg() << results.observations << "\n";
             } else {
                 results.status = SolverResult::SolverStatus::ERROR;
                 results.observations = "SA: No feasible solution found.";
-                utils::dbg << results.observations << "\n";
+                utils::threadDbg() << results.observations << "\n";
                 return results;
             }
         }
@@ -183,7 +212,7 @@ SolverResult Solver::simulatedAnnealingSolve() {
     }else{
         results.status = SolverResult::SolverStatus::ERROR;
         results.observations = "SA: No feasible solution found.";
-        utils::dbg << results.observations << "\n";
+        utils::threadDbg() << results.observations << "\n";
     }
 
     return results;
@@ -0,0 +1,164 @@
+#include "solver.h"
+#include <thread>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+bool SharedIncumbent::offer(const Candidate& offered, int offeredFitness) {
+    // Publish the fitness first, only one of several concurrent improvements wins each value
+    int current = fitness.load(std::memory_order_relaxed);
+    do {
+        if (offeredFitness >= current) {
+            return false;
+        }
+    } while (!fitness.compare_exchange_weak(current, offeredFitness, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+    // A better candidate may have been stored between the fitness CAS and taking the lock
+    std::lock_guard<std::mutex> lock(candidateMutex);
+    if (offeredFitness < candidateFitness) {
+        candidate.server_indices = offered.server_indices;
+        candidate.priorities = offered.priorities;
+        candidateFitness = offeredFitness;
+    }
+    return true;
+}
+
+int SharedIncumbent::load(Candidate& out) const {
+    std::lock_guard<std::mutex> lock(candidateMutex);
+    out.server_indices = candidate.server_indices;
+    out.priorities = candidate.priorities;
+    return candidateFitness;
+}
+
+SolverResult Solver::multiStartAnnealingSolve() {
+    /* Multi-start SA
+     * Key aspects:
+        * - sa_chains independent SA chains run in their own threads, each one with a copy of the
+        *   scheduler and config; the first one starts from HEFT (if enabled), the others from their own random search
+        * - Chains publish every new best to a shared incumbent (see SharedIncumbent)
+        * - A chain whose current fitness is more than restartGap above the incumbent continues from it
+        * - The chain kernel is simulatedAnnealingSolve() itself, so all SA parameters apply per chain
+        * - Each chain has its own random stream, but restarts depend on the timing of the other chains,
+        *   so runs are not reproducible for a given seed
+    */
+
+#ifdef _OPENMP
+    const int threadCount = omp_get_max_threads();
+#else
+    const int threadCount = 1;
+#endif
+    const int chainCount = config.sa_chains > 0 ? config.sa_chains : threadCount;
+
+    SolverResult results(
+        SolverResult::SolverStatus::NOT_STARTED,
+        scheduler.getInstanceName(),
+        SolverMethod::SIMULATED_ANNEALING,
+        config.sa_priorityRefinementMethod,
+        ScheduleState::NOT_SCHEDULED,
+        Candidate(scheduler.getTaskCount()),
+        config.alpha,
+        config.beta,
+        config.gamma,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        ""
+    );
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    SharedIncumbent sharedIncumbent(scheduler.getTaskCount());
+    std::vector<Scheduler> chainSchedulers(chainCount, scheduler);
+    std::vector<SolverConfig> chainConfigs(chainCount, config);
+    for (int k = 1; k < chainCount; ++k) {
+        chainConfigs[k].heftInit = false; // Only the first chain starts from HEFT, the others from their own random search
+    }
+    std::vector<SolverResult> chainResults(chainCount);
+    std::vector<std::string> chainLogs(chainCount); // Debug output of each chain, logged after joining
+    std::vector<utils::Rng> chainStreams = rng.split(chainCount);
+
+    auto runChain = [&](int k) {
+#ifdef _OPENMP
+        omp_set_num_threads(1); // Chains already fill the cores, batch evaluations inside a chain stay serial
+#endif
+        utils::DbgCapture capture;
+        Solver chain(chainSchedulers[k], chainConfigs[k]);
+        chain.incumbent = &sharedIncumbent;
+        chain.rng = chainStreams[k];
+        chainResults[k] = chain.simulatedAnnealingSolve();
+        chainLogs[k] = capture.buffer.str();
+    };
+
+    std::vector<std::thread> workers;
+    for (int k = 0; k < chainCount; ++k) {
+        workers.emplace_back(runChain, k);
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    for (int k = 0; k < chainCount; ++k) {
+        utils::dbg << "SA chain " << k << ":\n" << chainLogs[k];
+    }
+
+    // Merge: timeout if any chain timed out, stagnation if all stagnated
+    int iterations = 0;
+    int stagnated = 0;
+    int infeasible = 0;
+    results.status = SolverResult::SolverStatus::COMPLETED;
+    std::ostringstream chainSummary;
+    for (int k = 0; k < chainCount; ++k) {
+        const SolverResult& chainResult = chainResults[k];
+        iterations += chainResult.iterations;
+        results.infeasibleCandidates += chainResult.infeasibleCandidates;
+        results.repairedCandidates += chainResult.repairedCandidates;
+        if (chainResult.status == SolverResult::SolverStatus::TIMEOUT) {
+            results.status = SolverResult::SolverStatus::TIMEOUT;
+        }
+        if (chainResult.status == SolverResult::SolverStatus::STAGNATION) {
+            stagnated++;
+        }
+        if (chainResult.status == SolverResult::SolverStatus::INITIALIZATION_NOT_FEASIBLE) {
+            infeasible++;
+        }
+        for (const auto& chain : chainResult.chains) {
+            results.chains.push_back(chain);
+            chainSummary << " [" << k << ": " << chain.iterations << " it, " << chain.restarts << " restarts, best " << chain.bestFitness << "]";
+        }
+    }
+    if (stagnated == chainCount) {
+        results.status = SolverResult::SolverStatus::STAGNATION;
+    }
+    results.observations = "SA chains:" + chainSummary.str();
+    utils::dbg << results.observations << "\n";
+
+    if (infeasible == chainCount || sharedIncumbent.getFitness() == INT_MAX) {
+        results.status = SolverResult::SolverStatus::INITIALIZATION_NOT_FEASIBLE;
+        results.observations = "SA: Could not find initial feasible solution";
+        utils::dbg << results.observations << "\n";
+        return results;
+    }
+
+    Candidate best(scheduler.getTaskCount());
+    sharedIncumbent.load(best);
+    if (scheduler.schedule(best) != ScheduleState::SCHEDULED) {
+        results.status = SolverResult::SolverStatus::ERROR;
+        results.observations = "SA: Best candidate infeasible at the end.";
+        utils::dbg << results.observations << "\n";
+        return results;
+    }
+    results.scheduleState = scheduler.getScheduleState();
+    results.bestCandidate = best;
+    results.runtime_ms = utils::getElapsedMs(startTime);
+    results.iterations = iterations;
+    results.scheduleSpan = scheduler.getScheduleSpan();
+    results.finishTimeSum = scheduler.getFinishTimeSum();
+    results.processorsCost = scheduler.getProcessorsCost();
+    results.delayCost = scheduler.getDelayCost();
+    results.memoryUsageKB = utils::getPeakMemoryUsageKB();
+
+    return results;
+}
@@ -0,0 +1,269 @@
+#include "solver.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace {
+
+struct TabuMove {
+    enum Type { REASSIGN, SWAP } type;
+    int task;  // Task to reassign, or first task of the swap
+    int other; // New server of the task, or second task of the swap
+};
+
+} // namespace
+
+SolverResult Solver::tabuSearchSolve() {
+    /* Tabu search
+     * Key aspects:
+        * - Two move types: reassign a task to another server, and swap the priorities of two tasks on the same server
+        * - Each iteration evaluates a candidate list of ts_neighborhoodSize random moves (the whole neighborhood
+        *   if 0) and takes the best admissible one, even if it is worse than the current solution
+        * - A reassigned task cannot go back to its previous server, and tasks whose priorities were swapped
+        *   cannot be swapped again, for ts_tenure iterations, unless the move improves the best solution (aspiration)
+        * - Moves are evaluated in parallel, each thread applying them to its own copy of the current solution and
+        *   re-evaluating incrementally in its own workspace, with its best move so far as objective bound
+        * - The chosen move is the best one with the lowest index on ties, so a run only depends on the seed
+    */
+
+    const int maxIterations     = config.ts_maxIterations;
+    const int timeoutMs         = config.ts_timeout_sec*1000;
+    const int tenure            = config.ts_tenure;
+    const int neighborhoodSize  = config.ts_neighborhoodSize;
+    const int stagnationLimit   = config.ts_stagnationLimit;
+
+    SolverResult results(
+        SolverResult::SolverStatus::NOT_STARTED,
+        scheduler.getInstanceName(),
+        SolverMethod::TABU_SEARCH,
+        PriorityRefinementMethod::NORMAL_PERTURBATION, // (not used in tabu search)
+        ScheduleState::NOT_SCHEDULED,
+        Candidate(scheduler.getTaskCount()),
+        config.alpha,
+        config.beta,
+        config.gamma,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        ""
+    );
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    // Initialize with HEFT or random search to find an initial feasible solution
+    Candidate curr(scheduler.getTaskCount());
+    if (!findInitialSolution(curr, config.sa_maxInitTries)) {
+        results.status = SolverResult::SolverStatus::INITIALIZATION_NOT_FEASIBLE;
+        results.observations = "TS: Could not find initial feasible solution";
+        utils::dbg << results.observations << "\n";
+        return results;
+    }
+
+    const CompiledInstance& inst = scheduler.getCompiledInstance();
+    const int N = inst.task_count;
+    const int S = inst.server_count;
+
+    int currFitness = computeObjective();
+    Candidate best = curr;
+    int bestFitness = currFitness;
+
+    std::vector<int> serverTabuUntil(static_cast<size_t>(N) * S, 0); // Iteration until which task t cannot go back to server s
+    std::vector<int> swapTabuUntil(N, 0); // Iteration until which the priority of a task cannot be swapped
+
+#ifdef _OPENMP
+    const int threadCount = omp_get_max_threads();
+#else
+    const int threadCount = 1;
+#endif
+    std::vector<ScheduleWorkspace> workspaces(threadCount);
+    std::vector<Candidate> threadCandidates(threadCount, curr);
+    std::vector<std::vector<int>> serverTasks(S);
+    std::vector<TabuMove> moves;
+
+    int nonImprovingIterations = 0;
+    long long evaluations = 0;
+    int iteration;
+    results.status = SolverResult::SolverStatus::COMPLETED; // Default to completed unless timeoutMs or stagnation occurs
+
+    for (iteration = 0; iteration < maxIterations; ++iteration) {
+
+        // timeoutMs check
+        if (utils::getElapsedMs(startTime) >= timeoutMs) {
+            results.status = SolverResult::SolverStatus::TIMEOUT;
+            results.observations = "TS: Timeout reached after " + std::to_string(timeoutMs) + " seconds.";
+            utils::dbg << results.observations << "\n";
+            break;
+        }
+
+        // Tasks hosted by each server in the current solution (swaps are only useful between them)
+        for (auto& tasks : serverTasks) {
+            tasks.clear();
+        }
+        for (int t = 0; t < N; ++t) {
+            const int server = inst.fixed_server[t] >= 0 ? inst.fixed_server[t] : curr.server_indices[t];
+            if (server >= 0 && server < S) {
+                serverTasks[server].push_back(t);
+            }
+        }
+
+        // Candidate list: the whole neighborhood, or a sample of it
+        moves.clear();
+        if (neighborhoodSize <= 0) {
+            for (int t = 0; t < N; ++t) {
+                if (inst.fixed_server[t] < 0) {
+                    for (int k = 0; k < inst.getAllowedCount(t); ++k) {
+                        const int server = inst.getAllowedServer(t, k);
+                        if (server != curr.server_indices[t]) {
+                            moves.push_back(TabuMove{TabuMove::REASSIGN, t, server});
+                        }
+                    }
+                }
+            }
+            for (const auto& tasks : serverTasks) {
+                for (size_t i = 0; i < tasks.size(); ++i) {
+                    for (size_t j = i + 1; j < tasks.size(); ++j) {
+                        if (curr.priorities[tasks[i]] != curr.priorities[tasks[j]]) {
+                            moves.push_back(TabuMove{TabuMove::SWAP, tasks[i], tasks[j]});
+                        }
+                    }
+                }
+            }
+        } else {
+            for (int m = 0; m < neighborhoodSize; ++m) {
+                const int t = static_cast<int>(rng.below(N));
+                const int server = inst.fixed_server[t] >= 0 ? inst.fixed_server[t] : curr.server_indices[t];
+                const bool canSwap = server >= 0 && server < S && serverTasks[server].size() > 1;
+                const int allowedCount = inst.getAllowedCount(t);
+                if (canSwap && (inst.fixed_server[t] >= 0 || allowedCount < 2 || rng.uniform() < 0.5)) {
+                    int other = t;
+                    while (other == t) {
+                        other = serverTasks[server][rng.below(serverTasks[server].size())];
+                    }
+                    moves.push_back(TabuMove{TabuMove::SWAP, t, other});
+                } else if (inst.fixed_server[t] < 0 && allowedCount > 1) {
+                    // Any allowed server but the current one (which may not be allowed, e.g. in an imported solution)
+                    int target = curr.server_indices[t];
+                    while (target == curr.server_indices[t]) {
+                        target = inst.getAllowedServer(t, rng.below(allowedCount));
+                    }
+                    moves.push_back(TabuMove{TabuMove::REASSIGN, t, target});
+                }
+            }
+        }
+        const int moveCount = static_cast<int>(moves.size());
+        if (moveCount == 0) {
+            results.observations = "TS: Empty neighborhood.";
+            utils::dbg << results.observations << "\n";
+            break;
+        }
+
+        // Evaluate the moves: the best admissible one of each thread, then the best of all threads
+        std::vector<int> threadBestMove(threadCount, -1);
+        std::vector<int> threadBestFitness(threadCount, INT_MAX);
+        #pragma omp parallel num_threads(threadCount)
+        {
+#ifdef _OPENMP
+            const int th = omp_get_thread_num();
+#else
+            const int th = 0;
+#endif
+            Candidate& candidate = threadCandidates[th];
+            candidate = curr;
+            #pragma omp for schedule(static)
+            for (int m = 0; m < moveCount; ++m) {
+                const TabuMove& move = moves[m];
+                bool tabu;
+                if (move.type == TabuMove::REASSIGN) {
+                    tabu = serverTabuUntil[static_cast<size_t>(move.task) * S + move.other] > iteration;
+                    candidate.server_indices[move.task] = move.other;
+                } else {
+                    tabu = swapTabuUntil[move.task] > iteration || swapTabuUntil[move.other] > iteration;
+                    std::swap(candidate.priorities[move.task], candidate.priorities[move.other]);
+                }
+
+                // A tabu move is only admissible if it improves the best solution (aspiration)
+                const int threshold = tabu ? std::min(threadBestFitness[th], bestFitness) : threadBestFitness[th];
+                const EvalResult result = scheduler.evaluateIncremental(candidate, workspaces[th], getObjectiveBound(threshold));
+                if (result.state == ScheduleState::SCHEDULED) {
+                    const int fitness = static_cast<int>(computeObjective(result));
+                    if (fitness < threshold) {
+                        threadBestFitness[th] = fitness;
+                        threadBestMove[th] = m;
+                    }
+                }
+
+                // Undo the move
+                if (move.type == TabuMove::REASSIGN) {
+                    candidate.server_indices[move.task] = curr.server_indices[move.task];
+                } else {
+                    std::swap(candidate.priorities[move.task], candidate.priorities[move.other]);
+                }
+            }
+        }
+        evaluations += moveCount;
+
+        // Threads take contiguous ranges of moves, so the lowest thread wins ties with the lowest move index
+        int chosen = -1;
+        int chosenFitness = INT_MAX;
+        for (int th = 0; th < threadCount; ++th) {
+            if (threadBestMove[th] >= 0 && threadBestFitness[th] < chosenFitness) {
+                chosen = threadBestMove[th];
+                chosenFitness = threadBestFitness[th];
+            }
+        }
+        if (chosen < 0) {
+            nonImprovingIterations++; // every move is infeasible or tabu, sample again
+        } else {
+            const TabuMove& move = moves[chosen];
+            if (move.type == TabuMove::REASSIGN) {
+                serverTabuUntil[static_cast<size_t>(move.task) * S + curr.server_indices[move.task]] = iteration + 1 + tenure;
+                curr.server_indices[move.task] = move.other;
+            } else {
+                swapTabuUntil[move.task] = iteration + 1 + tenure;
+                swapTabuUntil[move.other] = iteration + 1 + tenure;
+                std::swap(curr.priorities[move.task], curr.priorities[move.other]);
+            }
+            currFitness = chosenFitness;
+
+            if (currFitness < bestFitness) {
+                bestFitness = currFitness;
+                best = curr;
+                nonImprovingIterations = 0;
+            } else {
+                nonImprovingIterations++;
+            }
+        }
+
+        // Stagnation check
+        if (nonImprovingIterations >= stagnationLimit) {
+            results.status = SolverResult::SolverStatus::STAGNATION;
+            results.observations = "TS: Stagnation reached after " + std::to_string(nonImprovingIterations) + " iterations without improvement.";
+            utils::dbg << results.observations << "\n";
+            break;
+        }
+    }
+
+    utils::dbg << "TS: " << evaluations << " move evaluations in " << iteration << " iterations.\n";
+
+    if (scheduler.schedule(best) != ScheduleState::SCHEDULED) {
+        results.status = SolverResult::SolverStatus::ERROR;
+        results.observations = "TS: Best candidate infeasible at the end.";
+        utils::dbg << results.observations << "\n";
+        return results;
+    }
+    results.scheduleState = scheduler.getScheduleState();
+    results.bestCandidate = best;
+    results.runtime_ms = utils::getElapsedMs(startTime);
+    results.iterations = iteration;
+    results.scheduleSpan = scheduler.getScheduleSpan();
+    results.finishTimeSum = scheduler.getFinishTimeSum();
+    results.processorsCost = scheduler.getProcessorsCost();
+    results.delayCost = scheduler.getDelayCost();
+    results.memoryUsageKB = utils::getPeakMemoryUsageKB();
+
+    return results;
+}
@@ -19,6 +19,16 @@ std::string solverMethodToString(SolverMethod method) {
             return "Genetic Algorithm";
         case SolverMethod::SIMULATED_ANNEALING:
             return "Simulated Annealing";
+        case SolverMethod::PARALLEL_TEMPERING:
+            return "Parallel Tempering";
+        case SolverMethod::HEFT:
+            return "HEFT";
+        case SolverMethod::TABU_SEARCH:
+            return "Tabu Search";
+        case SolverMethod::LARGE_NEIGHBORHOOD_SEARCH:
+            return "Large Neighborhood Search";
+        case SolverMethod::BRANCH_AND_BOUND:
+            return "Branch and Bound";
         default:
             return "Unknown Method";
     }
@@ -75,6 +85,8 @@ std::string SolverConfig::print() const {
             oss << "    initial_temperature: " << sa_initialTemperature << "\n";
             oss << "    cooling_rate: " << sa_coolingRate << "\n";
             oss << "    min_temperature: " << sa_minTemperature << "\n";
+            oss << "    chains: " << sa_chains << "\n";
+            oss << "    restart_gap: " << sa_restartGap << "\n";
             oss << "  Priority Refinement Method: " << priorityRefinementMethodToString(sa_priorityRefinementMethod) << "\n";
             oss << "  Refinement Parameters:\n";
             oss << "    sigma_max: " << sa_sigmaMax << "\n";
@@ -86,6 +98,55 @@ std::string SolverConfig::print() const {
             oss << "    pso_social_coefficient: " << sa_pso_socialCoefficient << "\n";
             break;
 
+        case SolverMethod::PARALLEL_TEMPERING:
+            oss << "PARALLEL_TEMPERING\n";
+            oss << "  Parameters:\n";
+            oss << "    replicas: " << pt_replicas << "\n";
+            oss << "    max_iterations: " << pt_maxIterations << "\n";
+            oss << "    timeout: " << pt_timeout_sec << "\n";
+            oss << "    exchange_interval: " << pt_exchangeInterval << "\n";
+            oss << "    min_temperature: " << pt_minTemperature << "\n";
+            oss << "    max_temperature: " << pt_maxTemperature << "\n";
+            oss << "    perturbation_rate: " << pt_perturbationRate << "\n";
+            oss << "    stagnation_limit: " << pt_stagnationLimit << "\n";
+            break;
+
+        case SolverMethod::HEFT:
+            oss << "HEFT\n";
+            break;
+
+        case SolverMethod::TABU_SEARCH:
+            oss << "TABU_SEARCH\n";
+            oss << "  Parameters:\n";
+            oss << "    max_iterations: " << ts_maxIterations << "\n";
+            oss << "    timeout: " << ts_timeout_sec << "\n";
+            oss << "    tenure: " << ts_tenure << "\n";
+            oss << "    neighborhood_size: " << ts_neighborhoodSize << "\n";
+            oss << "    stagnation_limit: " << ts_stagnationLimit << "\n";
+            break;
+
+        case SolverMethod::LARGE_NEIGHBORHOOD_SEARCH:
+            oss << "LARGE_NEIGHBORHOOD_SEARCH\n";
+            oss << "  Parameters:\n";
+            oss << "    max_iterations: " << lns_maxIterations << "\n";
+            oss << "    timeout: " << lns_timeout_sec << "\n";
+            oss << "    stagnation_limit: " << lns_stagnationLimit << "\n";
+            oss << "    destroy_fraction: " << lns_destroyFraction << "\n";
+            oss << "    max_destroy: " << lns_maxDestroy << "\n";
+            oss << "    exhaustive_limit: " << lns_exhaustiveLimit << "\n";
+            oss << "    segment_length: " << lns_segmentLength << "\n";
+            oss << "    reaction_factor: " << lns_reactionFactor << "\n";
+            oss << "    acceptance_gap: " << lns_acceptanceGap << "\n";
+            break;
+
+        case SolverMethod::BRANCH_AND_BOUND:
+            oss << "BRANCH_AND_BOUND\n";
+            oss << "  Parameters:\n";
+            oss << "    timeout: " << bb_timeout_sec << "\n";
+            oss << "    max_nodes: " << bb_maxNodes << "\n";
+            oss << "    warm_start: " << (bb_warmStart ? "true" : "false") << "\n";
+            break;
+
         case SolverMethod::GENETIC_ALGORITHM:
             oss << "GENETIC_ALGORITHM\n";
             oss << "  Parameters:\n";
@@ -97,8 +158,29 @@ std::string SolverConfig::print() const {
             oss << "    stagnation_limit: " << ga_stagnationLimit << "\n";
             oss << "    mutation_rate: " << ga_mutationRate << "\n";
             oss << "    crossover_rate: " << ga_crossoverRate << "\n";
+            oss << "    islands: " << ga_islands << "\n";
+            oss << "    migration_interval: " << ga_migrationInterval << "\n";
+            oss << "    migration_size: " << ga_migrationSize << "\n";
+            for (size_t k = 0; k < ga_islandsConfig.size(); ++k) {
+                const GAIslandConfig& cfg = ga_islandsConfig[k];
+                oss << "    island " << k << ":";
+                if (cfg.populationSize > 0) oss << " population_size=" << cfg.populationSize;
+                if (cfg.maxGenerations >= 0) oss << " max_generations=" << cfg.maxGenerations;
+                if (cfg.eliteCount >= 0) oss << " elite_count=" << cfg.eliteCount;
+                if (cfg.stagnationThreshold >= 0.0) oss << " stagnation_threshold=" << cfg.stagnationThreshold;
+                if (cfg.stagnationLimit >= 0) oss << " stagnation_limit=" << cfg.stagnationLimit;
+                if (cfg.mutationRate >= 0.0) oss << " mutation_rate=" << cfg.mutationRate;
+                if (cfg.crossoverRate >= 0.0) oss << " crossover_rate=" << cfg.crossoverRate;
+                oss << "\n";
+            }
             break;
     }
+    oss << "  Threads: " << (threads > 0 ? std::to_string(threads) : "default") << "\n";
+    oss << "  Seed: " << (seed != 0 ? std::to_string(seed) : "clock") << "\n";
+    oss << "  HEFT initial solution: " << (heftInit ? "true" : "false") << "\n";
+    oss << "  Repair steps: " << repairSteps << "\n";
+    oss << "  Ready queue: " << (readyQueue == ReadyQueueType::BUCKET_QUEUE ? "BUCKET" : "HEAP") << "\n";
+    oss << "  Staged rejection: " << (stagedRejection ? "true" : "false") << "\n";
 
     return oss.str();
 }  
@@ -187,6 +269,19 @@ std::string SolverResult::printTxt() const {
 
         oss << " \nBest objective value: " << getObjectiveValue() << "\n";
     }
+    if (!chains.empty()) {
+        oss << "  Chains:\n";
+        for (size_t k = 0; k < chains.size(); ++k) {
+            const ChainStats& chain = chains[k];
+            oss << "    [" << k << "] Iterations: " << chain.iterations
+                << ", Best fitness: " << chain.bestFitness
+                << ", Restarts: " << chain.restarts
+                << ", Incumbent updates: " << chain.incumbentUpdates << "\n";
+        }
+    }
+    if (infeasibleCandidates > 0) {
+        oss << "  Infeasible candidates: " << infeasibleCandidates << " (repaired: " << repairedCandidates << ")\n";
+    }
     
     return oss.str();
 };
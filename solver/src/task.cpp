@@ -23,8 +23,6 @@ Task::Task(
     this->a = a;
     this->u = static_cast<double>(C) / T; // Calculate utilization
     this->internal_idx = -1; // Default value (can be configured with setter)
-    this->start_time = 0; // Initial value
-    this->finish_time = 0; // Initial value
 };
 
 Task Task::fromJSON(const nlohmann::json& j) {
@@ -60,9 +58,6 @@ Task Task::fromJSON(const nlohmann::json& j) {
     if(j.contains("successors"))
         task.successors = utils::require_type<std::vector<std::string>>(j, "successors");
 
-    task.start_time = 0;
-    task.finish_time = task.start_time + task.C;
-
     // Following attributes will be set by Scheduler during tasks system loading
     task.internal_idx = -1;
     task.predecessors.clear();
@@ -106,8 +101,6 @@ std::string Task::print() const {
     }else{
         oss << "No predecessors.\n";
     }
-    oss << "Start time: " << start_time << "\n";
-    oss << "Finish time: " << finish_time << "\n";
 
     if (fixedAllocation) {
         oss << "Fixed Allocation: Yes, to " << fixedAllocationId << "\n";
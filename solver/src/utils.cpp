@@ -1,4 +1,5 @@
 #include "../include/utils.h"
+#include "../include/rng.h"
 
 namespace utils {
 
@@ -54,8 +55,10 @@ std::string getBinaryDirStr() {
 }
 
 std::string generate_uuid() {
-    static std::uniform_int_distribution<> dis(0, 15);
-    static std::uniform_int_distribution<> dis2(8, 11);
+    // Ids do not need to be reproducible, so this generator is seeded from the system
+    static thread_local Rng gen(std::random_device{}());
+    std::uniform_int_distribution<> dis(0, 15);
+    std::uniform_int_distribution<> dis2(8, 11);
 
     std::stringstream ss;
     int i;
@@ -213,12 +216,6 @@ T require_type(const nlohmann::json& obj, const std::string& key) {
     }
 }
 
-double randNormal(double mean, double stddev) {
-    // Thread-local random number generator
-    std::normal_distribution<double> distribution(mean, stddev);
-    return distribution(gen);
-}
-
 double clamp(double value, double minVal, double maxVal) {
     if (value < minVal) return minVal;
     if (value > maxVal) return maxVal;